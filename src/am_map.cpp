@@ -2015,6 +2015,48 @@ sector_t * AM_FakeFlat(AActor *viewer, sector_t * sec, sector_t * dest)
 //
 //=============================================================================
 
+//=============================================================================
+//
+// AM_getVisibleBounds
+//
+// Map space box around everything the automap window can show, so lines
+// and subsectors that cannot end up on screen are skipped before they are
+// classified, rotated and clipped. With rotation the window turns around
+// its center, so the circle enclosing it is used instead.
+//
+//=============================================================================
+
+static void AM_getVisibleBounds(FBoundingBox &box)
+{
+	if (am_rotate == 1 || (am_rotate == 2 && viewactive))
+	{
+		box.setBox(m_x + m_w / 2, m_y + m_h / 2, sqrt(m_w*m_w + m_h*m_h) / 2 + 1);
+	}
+	else
+	{
+		box = FBoundingBox(m_x - 1, m_y - 1, m_x2 + 1, m_y2 + 1);
+	}
+}
+
+static bool AM_boxOutside(const FBoundingBox &vis, double left, double bottom, double right, double top)
+{
+	return right < vis.Left() || left > vis.Right() || top < vis.Bottom() || bottom > vis.Top();
+}
+
+static bool AM_subsectorOutside(const FBoundingBox &vis, const subsector_t *sub)
+{
+	double left = FLT_MAX, bottom = FLT_MAX, right = -FLT_MAX, top = -FLT_MAX;
+	for (uint32_t j = 0; j < sub->numlines; ++j)
+	{
+		const vertex_t *v = sub->firstline[j].v1;
+		left = MIN(left, v->fX());
+		right = MAX(right, v->fX());
+		bottom = MIN(bottom, v->fY());
+		top = MAX(top, v->fY());
+	}
+	return AM_boxOutside(vis, left, bottom, right, top);
+}
+
 void AM_drawSubsectors()
 {
 	static TArray<FVector2> points;
@@ -2027,6 +2069,9 @@ void AM_drawSubsectors()
 	FColormap colormap;
 	PalEntry flatcolor;
 	mpoint_t originpt;
+	FBoundingBox vis;
+
+	AM_getVisibleBounds(vis);
 
 	auto &subsectors = level.subsectors;
 	for (unsigned i = 0; i < subsectors.Size(); ++i)
@@ -2046,6 +2091,11 @@ void AM_drawSubsectors()
 			continue;
 		}
 
+		if (AM_subsectorOutside(vis, &subsectors[i]))
+		{
+			continue;
+		}
+
 		// Fill the points array from the subsector.
 		points.Resize(subsectors[i].numlines);
 		for (uint32_t j = 0; j < subsectors[i].numlines; ++j)
@@ -2508,9 +2558,12 @@ void AM_drawWalls (bool allmap)
 {
 	static mline_t l;
 	int lock, color;
+	FBoundingBox vis;
 
 	int numportalgroups = am_portaloverlay ? Displacements.size : 0;
 
+	AM_getVisibleBounds(vis);
+
 	for (int p = numportalgroups - 1; p >= -1; p--)
 	{
 		if (p == MapPortalGroup) continue;
@@ -2541,6 +2594,12 @@ void AM_drawWalls (bool allmap)
 			}
 			else continue;
 
+			if (AM_boxOutside(vis, line.bbox[BOXLEFT] + offset.X, line.bbox[BOXBOTTOM] + offset.Y,
+				line.bbox[BOXRIGHT] + offset.X, line.bbox[BOXTOP] + offset.Y))
+			{
+				continue;
+			}
+
 			l.a.x = (line.v1->fX() + offset.X);
 			l.a.y = (line.v1->fY() + offset.Y);
 			l.b.x = (line.v2->fX() + offset.X);
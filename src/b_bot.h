@@ -78,6 +78,45 @@ struct botinfo_t
 	int lastteam;
 };
 
+//Sector connectivity graph used to route bots between areas.
+//Built on first use after a level is loaded and shared by all bots.
+class FBotNavGraph
+{
+public:
+	void Clear ();
+	void BeginTic ();
+	bool Connected (sector_t *from, sector_t *to);
+	line_t *NextLine (sector_t *from, sector_t *to, const DVector2 &start, const DVector2 &goal);
+
+private:
+	void Build ();
+	int Search (int from, int to, const DVector2 &start, const DVector2 &goal);
+
+	struct Edge
+	{
+		int sector;		//Sector on the other side.
+		int line;		//Line crossed to get there.
+	};
+	TArray<int> FirstEdge;	//Per sector, first entry in Edges. One extra entry at the end.
+	TArray<Edge> Edges;
+	TArray<int> Component;	//Sectors with the same value are linked by two-sided lines.
+	TMap<uint64_t, int> Routes;	//(from, to) -> line index + 1, or 0 for no route.
+	int Searches = 0;		//Searches left for this tic.
+
+	//Scratch space for Search().
+	struct OpenNode
+	{
+		double f;
+		int sector;
+	};
+	TArray<OpenNode> Open;
+	TArray<double> Cost;
+	TArray<DVector2> Entry;
+	TArray<int> Via;
+	TArray<int> Parent;
+	TArray<int> Touched;
+};
+
 //Used to keep all the globally needed variables in nice order.
 class FCajunMaster
 {
@@ -109,6 +148,9 @@ public:
 	bool CleanAhead (AActor *thing, double x, double y, ticcmd_t *cmd);
 	bool IsDangerous (sector_t *sec);
 
+	//(b_nav.cpp)
+	FBotNavGraph Nav;
+
 	TArray<FString> getspawned; //Array of bots (their names) which should be spawned when starting a game.
 	uint8_t freeze;			//Game in freeze mode.
 	uint8_t changefreeze;	//Game wants to change freeze mode.
@@ -200,7 +242,7 @@ private:
 	void Roam (ticcmd_t *cmd);
 	bool Move (ticcmd_t *cmd);
 	bool TryWalk (ticcmd_t *cmd);
-	void NewChaseDir (ticcmd_t *cmd);
+	void NewChaseDir (ticcmd_t *cmd, bool direct);
 	void TurnToAng ();
 	void Pitch (AActor *target);
 };
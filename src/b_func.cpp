@@ -74,6 +74,9 @@ bool DBot::Reachable (AActor *rtarget)
 		< player->mo->Height) //Where rtarget is, player->mo can't be.
 		return false;
 
+	if (!bglobal.Nav.Connected (player->mo->Sector, rtarget->Sector)) //No lines lead there.
+		return false;
+
 	sector_t *last_s = player->mo->Sector;
 	double last_z = last_s->floorplane.ZatPoint (player->mo);
 	double estimated_dist = player->mo->Distance2D(rtarget);
@@ -472,6 +475,7 @@ AActor *DBot::Find_enemy ()
 	{
 		player_t *client = &players[count];
 		if (playeringame[count]
+			&& client->mo != NULL
 			&& !player->mo->IsTeammate (client->mo)
 			&& client->mo != observer
 			&& client->mo->health > 0
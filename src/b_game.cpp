@@ -136,6 +136,7 @@ FCajunMaster::~FCajunMaster()
 void FCajunMaster::Main ()
 {
 	BotThinkCycles.Reset();
+	Nav.BeginTic ();
 
 	if (demoplayback || gamestate != GS_LEVEL || consoleplayer != Net_Arbitrator)
 		return;
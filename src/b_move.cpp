@@ -70,8 +70,9 @@ extern dirtype_t diags[4];
 //which can be a weapon/enemy/item whatever.
 void DBot::Roam (ticcmd_t *cmd)
 {
+	bool direct = Reachable(dest);
 
-	if (Reachable(dest))
+	if (direct)
 	{ // Straight towards it.
 		Angle = player->mo->AngleTo(dest);
 	}
@@ -90,7 +91,7 @@ void DBot::Roam (ticcmd_t *cmd)
 	// chase towards destination.
 	if (--player->mo->movecount < 0 || !Move (cmd))
 	{
-		NewChaseDir (cmd);
+		NewChaseDir (cmd, direct);
 	}
 }
 
@@ -163,7 +164,7 @@ bool DBot::TryWalk (ticcmd_t *cmd)
     return true;
 }
 
-void DBot::NewChaseDir (ticcmd_t *cmd)
+void DBot::NewChaseDir (ticcmd_t *cmd, bool direct)
 {
     dirtype_t   d[3];
 
@@ -185,6 +186,16 @@ void DBot::NewChaseDir (ticcmd_t *cmd)
 
 	DVector2 delta = player->mo->Vec2To(dest);
 
+	// If there's no straight way, head for the next line on the route instead.
+	if (!direct)
+	{
+		line_t *via = bglobal.Nav.NextLine(player->mo->Sector, dest->Sector, player->mo->Pos().XY(), dest->Pos().XY());
+		if (via != NULL)
+		{
+			delta = via->v1->fPos() + via->Delta() / 2 - player->mo->Pos().XY();
+		}
+	}
+
     if (delta.X > 10)
         d[1] = DI_EAST;
     else if (delta.X < -10)
@@ -0,0 +1,298 @@
+/*
+**
+**
+**---------------------------------------------------------------------------
+** Copyright 1999 Martin Colberg
+** Copyright 1999-2016 Randy Heit
+** Copyright 2005-2016 Christoph Oelckers
+** All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. The name of the author may not be used to endorse or promote products
+**    derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+** IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+** OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+** IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT,
+** INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+** NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+** THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**---------------------------------------------------------------------------
+**
+*/
+/********************************
+* B_Nav.c                       *
+* Description:                  *
+* Sector graph and route search *
+* shared by all bots            *
+*********************************/
+
+#include "doomdef.h"
+#include "doomstat.h"
+#include "p_local.h"
+#include "b_bot.h"
+#include "g_levellocals.h"
+
+#define NAV_SEARCHES_PER_TIC 4		//New routes searched per tic, for all bots together.
+#define NAV_MAXROUTES 65536			//Cached routes are forgotten when there are more than this.
+#define NAV_ROUTETIME (10*TICRATE)	//Cached routes are forgotten this often so they follow opened doors etc.
+
+void FBotNavGraph::Clear ()
+{
+	FirstEdge.Clear();
+	Edges.Clear();
+	Component.Clear();
+	Routes.Clear();
+	Open.Clear();
+	Cost.Clear();
+	Entry.Clear();
+	Via.Clear();
+	Parent.Clear();
+	Touched.Clear();
+	Searches = 0;
+}
+
+//Called once per tic from FCajunMaster::Main.
+void FBotNavGraph::BeginTic ()
+{
+	Searches = NAV_SEARCHES_PER_TIC;
+	if (level.maptime % NAV_ROUTETIME == 0 || Routes.CountUsed() > NAV_MAXROUTES)
+	{
+		Routes.Clear();
+	}
+}
+
+//Links every pair of sectors sharing a two-sided line. Blocking flags can
+//change at runtime, so they are only looked at when searching a route.
+void FBotNavGraph::Build ()
+{
+	unsigned numsectors = level.sectors.Size();
+	unsigned i;
+
+	FirstEdge.Resize(numsectors + 1);
+	memset(&FirstEdge[0], 0, FirstEdge.Size() * sizeof(int));
+
+	for (auto &line : level.lines)
+	{
+		if (line.frontsector != NULL && line.backsector != NULL && line.frontsector != line.backsector)
+		{
+			FirstEdge[line.frontsector->Index()]++;
+			FirstEdge[line.backsector->Index()]++;
+		}
+	}
+	int total = 0;
+	for (i = 0; i <= numsectors; i++)
+	{
+		int count = FirstEdge[i];
+		FirstEdge[i] = total;
+		total += count;
+	}
+	Edges.Resize(total);
+
+	TArray<int> fill;
+	fill.Resize(numsectors);
+	memcpy(&fill[0], &FirstEdge[0], numsectors * sizeof(int));
+	for (auto &line : level.lines)
+	{
+		if (line.frontsector != NULL && line.backsector != NULL && line.frontsector != line.backsector)
+		{
+			int front = line.frontsector->Index();
+			int back = line.backsector->Index();
+			Edges[fill[front]++] = { back, line.Index() };
+			Edges[fill[back]++] = { front, line.Index() };
+		}
+	}
+
+	//Flood fill the connected areas.
+	Component.Resize(numsectors);
+	for (i = 0; i < numsectors; i++)
+	{
+		Component[i] = -1;
+	}
+	TArray<int> stack;
+	for (i = 0; i < numsectors; i++)
+	{
+		if (Component[i] != -1)
+			continue;
+
+		Component[i] = i;
+		stack.Push(i);
+		int sec;
+		while (stack.Pop(sec))
+		{
+			for (int e = FirstEdge[sec]; e < FirstEdge[sec + 1]; e++)
+			{
+				int other = Edges[e].sector;
+				if (Component[other] == -1)
+				{
+					Component[other] = i;
+					stack.Push(other);
+				}
+			}
+		}
+	}
+
+	Cost.Resize(numsectors);
+	Entry.Resize(numsectors);
+	Via.Resize(numsectors);
+	Parent.Resize(numsectors);
+	for (i = 0; i < numsectors; i++)
+	{
+		Cost[i] = -1;
+	}
+}
+
+//False if no walk can ever lead from one sector to the other,
+//for example areas that can only be reached by teleporting.
+bool FBotNavGraph::Connected (sector_t *from, sector_t *to)
+{
+	if (Component.Size() != level.sectors.Size())
+	{
+		Build();
+	}
+	return Component[from->Index()] == Component[to->Index()];
+}
+
+//Returns the first line to cross on the way from one sector to another,
+//or NULL if there is none, it's the same sector or the search budget for
+//this tic has been used up.
+line_t *FBotNavGraph::NextLine (sector_t *from, sector_t *to, const DVector2 &start, const DVector2 &goal)
+{
+	if (from == to || !Connected(from, to))
+		return NULL;
+
+	uint64_t key = uint64_t(from->Index()) * level.sectors.Size() + to->Index();
+	int *route = Routes.CheckKey(key);
+	int result;
+	if (route != NULL)
+	{
+		result = *route;
+	}
+	else
+	{
+		if (Searches <= 0)
+			return NULL;
+
+		Searches--;
+		result = Search(from->Index(), to->Index(), start, goal) + 1;
+		Routes[key] = result;
+	}
+	return result > 0 ? &level.lines[result - 1] : NULL;
+}
+
+//A* over the sector graph. Sectors are entered at the middle of the line
+//crossed, which is also where the path length is measured from.
+int FBotNavGraph::Search (int from, int to, const DVector2 &start, const DVector2 &goal)
+{
+	auto push = [&](double f, int sector)
+	{
+		unsigned i = Open.Push({ f, sector });
+		while (i > 0)
+		{
+			unsigned parent = (i - 1) / 2;
+			if (Open[parent].f <= Open[i].f)
+				break;
+			std::swap(Open[parent], Open[i]);
+			i = parent;
+		}
+	};
+	auto pop = [&]() -> int
+	{
+		int sector = Open[0].sector;
+		OpenNode last;
+		Open.Pop(last);
+		if (Open.Size() > 0)
+		{
+			Open[0] = last;
+			unsigned i = 0;
+			for (;;)
+			{
+				unsigned child = i * 2 + 1;
+				if (child >= Open.Size())
+					break;
+				if (child + 1 < Open.Size() && Open[child + 1].f < Open[child].f)
+					child++;
+				if (Open[i].f <= Open[child].f)
+					break;
+				std::swap(Open[i], Open[child]);
+				i = child;
+			}
+		}
+		return sector;
+	};
+
+	int found = -1;
+
+	Open.Clear();
+	Touched.Clear();
+	Cost[from] = 0;
+	Entry[from] = start;
+	Via[from] = -1;
+	Parent[from] = -1;
+	Touched.Push(from);
+	push((goal - start).Length(), from);
+
+	while (Open.Size() > 0)
+	{
+		int sec = pop();
+		if (sec == to)
+		{
+			found = sec;
+			break;
+		}
+		for (int e = FirstEdge[sec]; e < FirstEdge[sec + 1]; e++)
+		{
+			line_t *line = &level.lines[Edges[e].line];
+			if (line->flags & (ML_BLOCKING|ML_BLOCKEVERYTHING|ML_BLOCK_PLAYERS))
+				continue;
+
+			int other = Edges[e].sector;
+			if (other != to && bglobal.IsDangerous(&level.sectors[other]))
+				continue;
+
+			DVector2 mid = line->v1->fPos() + line->Delta() / 2;
+			double cost = Cost[sec] + (mid - Entry[sec]).Length();
+			if (Cost[other] < 0)
+			{
+				Touched.Push(other);
+			}
+			else if (Cost[other] <= cost)
+			{
+				continue;
+			}
+			Cost[other] = cost;
+			Entry[other] = mid;
+			Via[other] = Edges[e].line;
+			Parent[other] = sec;
+			push(cost + (goal - mid).Length(), other);
+		}
+	}
+
+	int line = -1;
+	if (found != -1)
+	{
+		//Walk back to the first line after the starting sector.
+		for (int sec = found; Parent[sec] != -1; sec = Parent[sec])
+		{
+			line = Via[sec];
+		}
+	}
+
+	for (auto sec : Touched)
+	{
+		Cost[sec] = -1;
+	}
+	return line;
+}
@@ -317,7 +317,7 @@ void DBot::ThinkForMove (ticcmd_t *cmd)
 				{
 					dest = mate;
 				}
-				else if ((playeringame[(r&(MAXPLAYERS-1))]) && players[(r&(MAXPLAYERS-1))].mo->health > 0)
+				else if ((playeringame[(r&(MAXPLAYERS-1))]) && players[(r&(MAXPLAYERS-1))].mo != NULL && players[(r&(MAXPLAYERS-1))].mo->health > 0)
 				{
 					dest = players[(r&(MAXPLAYERS-1))].mo; 
 				}
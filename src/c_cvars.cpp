@@ -53,6 +53,7 @@
 #include "colormatcher.h"
 #include "menu/menu.h"
 #include "vm.h"
+#include "stats.h"
 
 struct FLatchedValue
 {
@@ -68,6 +69,13 @@ bool FBaseCVar::m_UseCallback = false;
 
 FBaseCVar *CVars = NULL;
 
+// Cvars are also chained by name so that lookups do not have to walk the
+// whole list. This is a plain array so it is usable by cvars that are
+// constructed before main() runs.
+enum { CVAR_HASH_SIZE = 509 };
+static FBaseCVar *CVarHash[CVAR_HASH_SIZE];
+static int CVarLookups;
+
 int cvar_defflags;
 
 FBaseCVar::FBaseCVar (const FBaseCVar &var)
@@ -91,6 +99,10 @@ FBaseCVar::FBaseCVar (const char *var_name, uint32_t flags, void (*callback)(FBa
 		Name = copystring (var_name);
 		m_Next = CVars;
 		CVars = this;
+
+		FBaseCVar **chain = &CVarHash[MakeKey(var_name) % CVAR_HASH_SIZE];
+		m_HashNext = *chain;
+		*chain = this;
 	}
 
 	if (var)
@@ -129,6 +141,16 @@ FBaseCVar::~FBaseCVar ()
 			else
 				CVars = m_Next;
 		}
+
+		FBaseCVar **chain = &CVarHash[MakeKey(Name) % CVAR_HASH_SIZE];
+		while (*chain != NULL && *chain != this)
+		{
+			chain = &(*chain)->m_HashNext;
+		}
+		if (*chain != NULL)
+		{
+			*chain = m_HashNext;
+		}
 		C_RemoveTabCommand(Name);
 		delete[] Name;
 	}
@@ -1518,13 +1540,24 @@ void C_ForgetCVars (void)
 FBaseCVar *FindCVar (const char *var_name, FBaseCVar **prev)
 {
 	FBaseCVar *var;
-	FBaseCVar *dummy;
 
 	if (var_name == NULL)
 		return NULL;
 
+	CVarLookups++;
+
+	// Only callers that want to unlink the cvar need the list predecessor.
 	if (prev == NULL)
-		prev = &dummy;
+	{
+		var = CVarHash[MakeKey(var_name) % CVAR_HASH_SIZE];
+		while (var)
+		{
+			if (stricmp (var->GetName (), var_name) == 0)
+				break;
+			var = var->m_HashNext;
+		}
+		return var;
+	}
 
 	var = CVars;
 	*prev = NULL;
@@ -1560,7 +1593,9 @@ FBaseCVar *FindCVarSub (const char *var_name, int namelen)
 	if (var_name == NULL)
 		return NULL;
 
-	var = CVars;
+	CVarLookups++;
+
+	var = CVarHash[MakeKey(var_name, namelen) % CVAR_HASH_SIZE];
 	while (var)
 	{
 		const char *probename = var->GetName ();
@@ -1570,7 +1605,7 @@ FBaseCVar *FindCVarSub (const char *var_name, int namelen)
 		{
 			break;
 		}
-		var = var->m_Next;
+		var = var->m_HashNext;
 	}
 	return var;
 }
@@ -1598,6 +1633,28 @@ FBaseCVar *GetCVar(AActor *activator, const char *cvarname)
 	}
 }
 
+//==========================================================================
+//
+// Shows how often cvars get looked up by name, mostly from scripts
+//
+//==========================================================================
+
+ADD_STAT(cvars)
+{
+	static int LastLookups, LastTic;
+	FString out;
+	int tics = gametic - LastTic;
+
+	out.Format("Lookups: %d  Per tic: %.1f", CVarLookups,
+		tics > 0 ? double(CVarLookups - LastLookups) / tics : 0.);
+	if (tics > 0)
+	{
+		LastLookups = CVarLookups;
+		LastTic = gametic;
+	}
+	return out;
+}
+
 FBaseCVar *GetUserCVar(int playernum, const char *cvarname)
 {
 	if ((unsigned)playernum >= MAXPLAYERS || !playeringame[playernum])
@@ -42,6 +42,7 @@
 #include <string.h>
 
 #include "doomtype.h"
+#include "templates.h"
 #include "colormatcher.h"
 #include "v_palette.h"
 
@@ -63,12 +64,74 @@ FColorMatcher::FColorMatcher (const FColorMatcher &other)
 FColorMatcher &FColorMatcher::operator= (const FColorMatcher &other)
 {
 	Pal = other.Pal;
+	CellStart = other.CellStart;
+	Candidates = other.Candidates;
 	return *this;
 }
 
 void FColorMatcher::SetPalette (const uint32_t *palette)
 {
 	Pal = (const PalEntry *)palette;
+	BuildCube ();
+}
+
+//==========================================================================
+//
+// FColorMatcher :: BuildCube
+//
+// A color can only be the closest one somewhere inside a cell if its
+// distance to the nearest point of the cell does not exceed the largest
+// distance of any other color to the cell. Checking only these candidates
+// in ascending order gives the same result as BestColor.
+//
+//==========================================================================
+
+void FColorMatcher::BuildCube ()
+{
+	CellStart.Clear();
+	Candidates.Clear();
+	if (Pal == NULL)
+		return;
+
+	const int cellsize = 1 << CELL_SHIFT;
+	int mindist[256];
+
+	CellStart.Resize(CUBE_SIZE * CUBE_SIZE * CUBE_SIZE + 1);
+	int cell = 0;
+	for (int r = 0; r < 256; r += cellsize)
+	{
+		for (int g = 0; g < 256; g += cellsize)
+		{
+			for (int b = 0; b < 256; b += cellsize, cell++)
+			{
+				auto axis = [=](int v, int lo, int &nearest, int &farthest)
+				{
+					int dlo = v - lo, dhi = v - (lo + cellsize - 1);
+					nearest = v < lo ? dlo * dlo : v > lo + cellsize - 1 ? dhi * dhi : 0;
+					farthest = MAX(dlo * dlo, dhi * dhi);
+				};
+				int bestmax = INT_MAX;
+				for (int color = 1; color < 255; color++)
+				{
+					int nr, ng, nb, fr, fg, fb;
+					axis(Pal[color].r, r, nr, fr);
+					axis(Pal[color].g, g, ng, fg);
+					axis(Pal[color].b, b, nb, fb);
+					mindist[color] = nr + ng + nb;
+					bestmax = MIN(bestmax, fr + fg + fb);
+				}
+				CellStart[cell] = Candidates.Size();
+				for (int color = 1; color < 255; color++)
+				{
+					if (mindist[color] <= bestmax)
+					{
+						Candidates.Push(color);
+					}
+				}
+			}
+		}
+	}
+	CellStart[cell] = Candidates.Size();
 }
 
 uint8_t FColorMatcher::Pick (int r, int g, int b)
@@ -76,5 +139,31 @@ uint8_t FColorMatcher::Pick (int r, int g, int b)
 	if (Pal == NULL)
 		return 1;
 
-	return (uint8_t)BestColor ((uint32_t *)Pal, r, g, b);
+	if ((r | g | b) & ~255)
+	{
+		return (uint8_t)BestColor ((uint32_t *)Pal, r, g, b);
+	}
+
+	int cell = (((r >> CELL_SHIFT) * CUBE_SIZE) + (g >> CELL_SHIFT)) * CUBE_SIZE + (b >> CELL_SHIFT);
+	const uint8_t *color = &Candidates[CellStart[cell]];
+	const uint8_t *end = color + (CellStart[cell + 1] - CellStart[cell]);
+	int bestcolor = *color;
+	int bestdist = INT_MAX;
+
+	for (; color < end; color++)
+	{
+		int x = r - Pal[*color].r;
+		int y = g - Pal[*color].g;
+		int z = b - Pal[*color].b;
+		int dist = x*x + y*y + z*z;
+		if (dist < bestdist)
+		{
+			if (dist == 0)
+				return *color;
+
+			bestdist = dist;
+			bestcolor = *color;
+		}
+	}
+	return bestcolor;
 }
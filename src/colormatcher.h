@@ -51,7 +51,15 @@ public:
 	FColorMatcher &operator= (const FColorMatcher &other);
 
 private:
+	// Palette colors that can be the closest match for some RGB value in
+	// each cell of a 32x32x32 cube, so Pick only needs to check a few.
+	enum { CUBE_BITS = 5, CUBE_SIZE = 1 << CUBE_BITS, CELL_SHIFT = 8 - CUBE_BITS };
+
+	void BuildCube ();
+
 	const PalEntry *Pal;
+	TArray<int> CellStart;
+	TArray<uint8_t> Candidates;
 };
 
 extern FColorMatcher ColorMatcher;
@@ -97,6 +97,7 @@
 #include "hardware.h"
 #include "sbarinfo.h"
 #include "d_net.h"
+#include "i_net.h"
 #include "g_level.h"
 #include "d_event.h"
 #include "d_netinf.h"
@@ -1042,7 +1043,10 @@ void D_DoomLoop ()
 			}
 			// Update display, next frame, with current state.
 			I_StartTic ();
-			D_Display ();
+			if (!net_dedicated)
+			{
+				D_Display ();
+			}
 			if (wantToRestart)
 			{
 				wantToRestart = false;
@@ -2446,6 +2450,10 @@ void D_DoomMain (void)
 
 		if (!restart)
 		{
+			// D_CheckNetGame confirms this much later, but a dedicated host
+			// must not open a window or a sound device in the meantime.
+			net_dedicated = I_CheckDedicatedHost ();
+
 			if (!batchrun) Printf ("I_Init: Setting up machine state.\n");
 			I_Init ();
 			I_CreateRenderer();
@@ -2645,9 +2653,18 @@ void D_DoomMain (void)
 				throw CNoRunExit();
 			}
 
-			V_Init2();
-			gl_PatchMenu();
-			UpdateJoystickMenu(NULL);
+			if (!net_dedicated)
+			{
+				V_Init2();
+				gl_PatchMenu();
+				UpdateJoystickMenu(NULL);
+			}
+			else
+			{
+				// Like a batch run, a dedicated host keeps the dummy frame
+				// buffer from V_Init, so there are no graphics to precache.
+				precache = false;
+			}
 
 			v = Args->CheckValue ("-loadgame");
 			if (v)
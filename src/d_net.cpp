@@ -87,6 +87,16 @@ doomcom_t		doomcom;
 enum { NET_PeerToPeer, NET_PacketServer };
 uint8_t NetMode = NET_PeerToPeer;
 
+// Set on an arbitrator started with -dedicated. Such a host does not render,
+// play sound or generate input of its own; it only relays ticcmds in packet
+// server mode so every client talks to a single node.
+bool net_dedicated;
+
+// Set on every node, and in demos recorded from such a game, when player 0
+// is a dedicated host. That slot stays in the game so the host's ticcmds
+// still drive the protocol, but it never gets a pawn.
+bool net_dedicatedhost;
+
 
 
 //
@@ -1475,8 +1485,9 @@ bool DoArbitrate (void *userdata)
 
 			ticdup = doomcom.ticdup = netbuffer[1];
 			NetMode = netbuffer[2];
+			net_dedicatedhost = !!netbuffer[3];
 
-			stream = &netbuffer[3];
+			stream = &netbuffer[4];
 			s = ReadString (&stream);
 			startmap = s;
 			delete[] s;
@@ -1542,7 +1553,8 @@ bool DoArbitrate (void *userdata)
 		netbuffer[0] = NCMD_SETUP+2;
 		netbuffer[1] = (uint8_t)doomcom.ticdup;
 		netbuffer[2] = NetMode;
-		stream = &netbuffer[3];
+		netbuffer[3] = net_dedicatedhost;
+		stream = &netbuffer[4];
 		WriteString (startmap, &stream);
 		WriteLong (rngseed, &stream);
 		C_WriteCVars (&stream, CVAR_SERVERINFO, true);
@@ -1706,10 +1718,20 @@ void D_CheckNetGame (void)
 		{
 			NetMode = atoi(v) != 0 ? NET_PacketServer : NET_PeerToPeer;
 		}
+		if (net_dedicated)
+		{
+			// A dedicated host only makes sense as the hub of a packet server game.
+			if (v != NULL && NetMode != NET_PacketServer)
+			{
+				Printf(TEXTCOLOR_YELLOW "Notice: -dedicated overrides -netmode 0.\n");
+			}
+			NetMode = NET_PacketServer;
+		}
+		net_dedicatedhost = net_dedicated;
 		if (doomcom.numnodes > 1)
 		{
 			Printf("Selected " TEXTCOLOR_BLUE "%s" TEXTCOLOR_NORMAL " networking mode. (%s)\n", NetMode == NET_PeerToPeer ? "peer to peer" : "packet server",
-				v != NULL ? "forced" : "auto");
+				net_dedicated ? "dedicated" : v != NULL ? "forced" : "auto");
 		}
 
 		if (Args->CheckParm("-extratic"))
@@ -1821,7 +1843,8 @@ void TryRunTics (void)
 	// will all be wasted anyway.
 	if (pauseext) 
 		r_NoInterpolate = true;
-	bool doWait = cl_capfps || r_NoInterpolate /*|| netgame*/;
+	// A dedicated host has no frames to draw between tics, so always sleep.
+	bool doWait = cl_capfps || r_NoInterpolate || net_dedicated /*|| netgame*/;
 
 	// get real tics
 	if (doWait)
@@ -2222,7 +2245,10 @@ void Net_DoCommand (int type, uint8_t **stream, int player)
 			x = ReadWord (stream);
 			y = ReadWord (stream);
 			z = ReadWord (stream);
-			P_TeleportMove (players[player].mo, DVector3(x, y, z), true);
+			if (players[player].mo != NULL)
+			{
+				P_TeleportMove (players[player].mo, DVector3(x, y, z), true);
+			}
 		}
 		break;
 
@@ -2260,7 +2286,7 @@ void Net_DoCommand (int type, uint8_t **stream, int player)
 		break;
 
 	case DEM_INVUSEALL:
-		if (gamestate == GS_LEVEL && !paused)
+		if (gamestate == GS_LEVEL && !paused && players[player].mo != NULL)
 		{
 			AInventory *item = players[player].mo->Inventory;
 			auto pitype = PClass::FindActor(NAME_PuzzleItem);
@@ -2285,7 +2311,8 @@ void Net_DoCommand (int type, uint8_t **stream, int player)
 			if (type == DEM_INVDROP) amt = ReadLong(stream);
 
 			if (gamestate == GS_LEVEL && !paused
-				&& players[player].playerstate != PST_DEAD)
+				&& players[player].playerstate != PST_DEAD
+				&& players[player].mo != NULL)
 			{
 				AInventory *item = players[player].mo->Inventory;
 				while (item != NULL && item->InventoryID != which)
@@ -2386,7 +2413,10 @@ void Net_DoCommand (int type, uint8_t **stream, int player)
 
 	case DEM_SPRAY:
 		s = ReadString(stream);
-		SprayDecal(players[player].mo, s);
+		if (players[player].mo != NULL)
+		{
+			SprayDecal(players[player].mo, s);
+		}
 		break;
 
 	case DEM_MDK:
@@ -2773,6 +2803,10 @@ void Net_SkipCommand (int type, uint8_t **stream)
 			skip = 6;
 			break;
 
+		case DEM_SYNCCHECK:
+			skip = 8;
+			break;
+
 		case DEM_INVUSE:
 			skip = 4;
 			break;
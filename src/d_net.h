@@ -152,6 +152,14 @@ extern	int 			nodeforplayer[MAXPLAYERS];
 
 extern	ticcmd_t		netcmds[MAXPLAYERS][BACKUPTICS];
 extern	int 			ticdup;
+extern	bool			net_dedicated;
+extern	bool			net_dedicatedhost;
+
+// True for the player slot of a dedicated host, which must never get a pawn.
+inline bool Net_IsDedicatedHost (int player)
+{
+	return net_dedicatedhost && player == 0;
+}
 
 // [RH]
 // New generic packet structure:
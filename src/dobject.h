@@ -261,6 +261,12 @@ public:
 		return Class;
 	}
 
+	// False while the object is still being constructed.
+	bool HasClass() const
+	{
+		return Class != nullptr;
+	}
+
 	void SetClass (PClass *inClass)
 	{
 		Class = inClass;
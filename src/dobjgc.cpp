@@ -161,6 +161,17 @@ bool FinalGC;
 
 static DSectorMarker *SectorMarker;
 
+// Statistics for the gc stat page. Times are in milliseconds.
+static cycle_t StepCycles;
+static double LastStepTime;			// duration of the most recent Step
+static double MaxStepTime;			// longest Step of the current collection
+static double LastCycleMaxStep;		// longest Step of the last finished collection
+static double LastCycleTime;		// total time spent in the last finished collection
+static double CurCycleTime;
+static size_t CurFreed;				// bytes released by the current collection's sweep
+static size_t LastFreed;
+static int Collections;
+
 // CODE --------------------------------------------------------------------
 
 //==========================================================================
@@ -442,12 +453,19 @@ static size_t SingleStep()
 		}
 		//assert(old >= AllocBytes);
 		Estimate -= MAX<size_t>(0, old - AllocBytes);
+		if (old > AllocBytes)
+		{
+			CurFreed += old - AllocBytes;
+		}
 		return (GCSWEEPMAX - finalize_count) * GCSWEEPCOST + finalize_count * GCFINALIZECOST;
 	  }
 
 	case GCS_Finalize:
 		State = GCS_Pause;		// end collection
 		Dept = 0;
+		LastFreed = CurFreed;
+		CurFreed = 0;
+		Collections++;
 		return 0;
 
 	default:
@@ -473,6 +491,8 @@ void Step()
 	{
 		lim = (~(size_t)0) / 2;		// no limit
 	}
+	StepCycles.Reset();
+	StepCycles.Clock();
 	Dept += AllocBytes - Threshold;
 	do
 	{
@@ -497,6 +517,17 @@ void Step()
 		SetThreshold();
 	}
 	StepCount++;
+
+	StepCycles.Unclock();
+	LastStepTime = StepCycles.TimeMS();
+	MaxStepTime = MAX(MaxStepTime, LastStepTime);
+	CurCycleTime += LastStepTime;
+	if (State == GCS_Pause)
+	{
+		LastCycleMaxStep = MaxStepTime;
+		LastCycleTime = CurCycleTime;
+		MaxStepTime = CurCycleTime = 0;
+	}
 }
 
 //==========================================================================
@@ -509,6 +540,11 @@ void Step()
 
 void FullGC()
 {
+	// An interrupted incremental collection is folded into this one, which
+	// is recorded on the stat page as a single step.
+	MaxStepTime = CurCycleTime = 0;
+	StepCycles.Reset();
+	StepCycles.Clock();
 	if (State <= GCS_Propagate)
 	{
 		// Reset sweep mark to sweep all elements (returning them to white)
@@ -528,6 +564,9 @@ void FullGC()
 		SingleStep();
 	}
 	SetThreshold();
+
+	StepCycles.Unclock();
+	LastStepTime = LastCycleMaxStep = LastCycleTime = StepCycles.TimeMS();
 }
 
 //==========================================================================
@@ -745,6 +784,10 @@ ADD_STAT(gc)
 	{
 		out.AppendFormat("  %zuK", (GC::Dept + 1023) >> 10);
 	}
+	out.AppendFormat("\nStep:%6.3f ms  Max:%6.3f ms  Last cycle: %d, %6.3f ms total, %6.3f ms max, %6zuK freed",
+		GC::LastStepTime, GC::MaxStepTime,
+		GC::Collections, GC::LastCycleTime, GC::LastCycleMaxStep,
+		(GC::LastFreed + 1023) >> 10);
 	return out;
 }
 
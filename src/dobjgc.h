@@ -25,6 +25,7 @@ enum EObjectFlags
 	OF_Transient		= 1 << 11,		// Object should not be archived (references to it will be nulled on disk)
 	OF_Spawned			= 1 << 12,      // Thinker was spawned at all (some thinkers get deleted before spawning)
 	OF_Released			= 1 << 13,		// Object was released from the GC system and should not be processed by GC function
+	OF_Counted			= 1 << 14,		// Thinker is included in its class's ThinkerCount for its statnum
 };
 
 template<class T> class TObjPtr;
@@ -69,6 +69,7 @@ public:
 	TArray<FTypeAndOffset> SpecialInits;
 	TArray<PField *> Fields;
 	PClassType			*VMType = nullptr;
+	TArray<int>			 ThinkerCount;		// per statnum: thinkers of this class or a descendant in the regular thinker lists
 
 	void (*ConstructNative)(void *);
 
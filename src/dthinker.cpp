@@ -41,6 +41,7 @@
 #include "serializer.h"
 #include "d_player.h"
 #include "vm.h"
+#include "types.h"
 
 
 static int ThinkCount;
@@ -57,6 +58,10 @@ FThinkerList DThinker::Thinkers[MAX_STATNUM+2];
 FThinkerList DThinker::FreshThinkers[MAX_STATNUM+1];
 bool DThinker::bSerialOverride = false;
 
+// Thinkers that were put into one of the regular lists from inside their
+// constructor, before their class was known. They get counted later.
+static TArray<DThinker *> PendingCount;
+
 //==========================================================================
 //
 //
@@ -85,6 +90,20 @@ void FThinkerList::AddTail(DThinker *thinker)
 	GC::WriteBarrier(thinker, Sentinel);
 	GC::WriteBarrier(tail, thinker);
 	GC::WriteBarrier(Sentinel, thinker);
+
+	// Fresh thinkers are always searched, so only the regular lists are counted.
+	if (this >= &DThinker::Thinkers[0] && this < &DThinker::Thinkers[countof(DThinker::Thinkers)])
+	{
+		thinker->CountedStat = uint8_t(this - &DThinker::Thinkers[0]);
+		if (thinker->HasClass())
+		{
+			thinker->Count();
+		}
+		else
+		{
+			PendingCount.Push(thinker);
+		}
+	}
 }
 
 //==========================================================================
@@ -281,6 +300,22 @@ void DThinker::Remove()
 	{
 		NextToThink = NextThinker;
 	}
+	if (ObjectFlags & OF_Counted)
+	{
+		for (PClass *cls = GetClass(); cls != nullptr; cls = cls->ParentClass)
+		{
+			cls->ThinkerCount[CountedStat]--;
+		}
+		ObjectFlags &= ~OF_Counted;
+	}
+	else if (PendingCount.Size() > 0)
+	{
+		unsigned index = PendingCount.Find(this);
+		if (index < PendingCount.Size())
+		{
+			PendingCount.Delete(index);
+		}
+	}
 	DThinker *prev = PrevThinker;
 	DThinker *next = NextThinker;
 	assert(prev != NULL && next != NULL);
@@ -295,6 +330,53 @@ void DThinker::Remove()
 	PrevThinker = NULL;
 }
 
+//==========================================================================
+//
+// DThinker :: Count
+//
+// Adds this thinker to the counts of its class and all its ancestors for
+// the list it is in, which lets FThinkerIterator skip every regular list
+// that cannot contain anything it is looking for.
+//
+//==========================================================================
+
+void DThinker::Count()
+{
+	for (PClass *cls = GetClass(); cls != nullptr; cls = cls->ParentClass)
+	{
+		if (cls->ThinkerCount.Size() == 0)
+		{
+			cls->ThinkerCount.Resize(countof(Thinkers));
+			memset(&cls->ThinkerCount[0], 0, cls->ThinkerCount.Size() * sizeof(int));
+		}
+		cls->ThinkerCount[CountedStat]++;
+	}
+	ObjectFlags |= OF_Counted;
+}
+
+void DThinker::CountPendingThinkers()
+{
+	for (unsigned i = 0; i < PendingCount.Size(); )
+	{
+		if (PendingCount[i]->HasClass())
+		{
+			PendingCount[i]->Count();
+			PendingCount.Delete(i);
+		}
+		else i++;
+	}
+}
+
+bool DThinker::MayHaveThinkers(const PClass *type, int statnum)
+{
+	if (PendingCount.Size() > 0)
+	{
+		CountPendingThinkers();
+		if (PendingCount.Size() > 0) return true;
+	}
+	return (unsigned)statnum < type->ThinkerCount.Size() && type->ThinkerCount[statnum] > 0;
+}
+
 //==========================================================================
 //
 // 
@@ -562,6 +644,15 @@ void DThinker::CallTick()
 {
 	IFVIRTUAL(DThinker, Tick)
 	{
+		// VMCall would hand a native Tick to NativeCall, which only unpacks
+		// the parameters again to reach the C++ virtual. Call that directly
+		// for the many thinkers (movers, lights, scrollers...) that are not
+		// overridden in a script.
+		if (func->VarFlags & VARF_Native)
+		{
+			Tick();
+			return;
+		}
 		// Without the type cast this picks the 'void *' assignment...
 		VMValue params[1] = { (DObject*)this };
 		VMCall(func, params, 1, nullptr, 0);
@@ -669,6 +760,11 @@ DThinker *FThinkerIterator::Next (bool exact)
 	{
 		do
 		{
+			if (m_CurrThinker != NULL && !m_SearchingFresh && !DThinker::MayHaveThinkers(m_ParentType, m_Stat))
+			{
+				// Nothing of this type is left in this list.
+				m_CurrThinker = NULL;
+			}
 			if (m_CurrThinker != NULL)
 			{
 				while (!(m_CurrThinker->ObjectFlags & OF_Sentinel))
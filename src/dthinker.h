@@ -89,6 +89,7 @@ public:
 	static void MarkRoots();
 
 	static DThinker *FirstThinker (int statnum);
+	static bool MayHaveThinkers (const PClass *type, int statnum);
 	static bool bSerialOverride;
 
 	// only used internally but Create needs access.
@@ -98,6 +99,8 @@ private:
 	static void DestroyThinkersInList (FThinkerList &list);
 	static int TickThinkers (FThinkerList *list, FThinkerList *dest);	// Returns: # of thinkers ticked
 	static void SaveList(FSerializer &arc, DThinker *node);
+	static void CountPendingThinkers();
+	void Count();
 	void Remove();
 
 	static FThinkerList Thinkers[MAX_STATNUM+2];		// Current thinkers
@@ -109,6 +112,7 @@ private:
 	friend class FSerializer;
 
 	DThinker *NextThinker, *PrevThinker;
+	uint8_t CountedStat;	// regular list this thinker is counted in (see OF_Counted)
 };
 
 class FThinkerIterator
@@ -287,7 +287,7 @@ static int T_GetPlayerNum(const svalue_t &arg)
 	{
 		return -1;
 	}
-	if(!playeringame[playernum]) // no error, just return -1
+	if(!playeringame[playernum] || players[playernum].mo == NULL) // no error, just return -1
 	{
 		return -1;
 	}
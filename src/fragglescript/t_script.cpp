@@ -629,7 +629,12 @@ void T_PreprocessScripts()
 		// get the other scripts
 		
 		// levelscript started by player 0 'superplayer'
+		// (or the first player with a pawn when slot 0 is a dedicated host)
 		th->LevelScript->trigger = players[0].mo;
+		for (int i = 1; i < MAXPLAYERS && th->LevelScript->trigger == NULL; i++)
+		{
+			if (playeringame[i]) th->LevelScript->trigger = players[i].mo;
+		}
 		
 		th->LevelScript->Preprocess();
 		th->LevelScript->ParseScript();
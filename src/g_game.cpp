@@ -126,6 +126,7 @@ CVAR (Bool, longsavemessages, true, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
 CVAR (String, save_dir, "", CVAR_ARCHIVE|CVAR_GLOBALCONFIG);
 CVAR (Bool, cl_waitforsave, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG);
 EXTERN_CVAR (Float, con_midtime);
+EXTERN_CVAR (Bool, acs_profiletime);
 
 //==========================================================================
 //
@@ -455,6 +456,7 @@ CCMD (invuse)
 
 CCMD(invquery)
 {
+	if (players[consoleplayer].mo == NULL) return;
 	AInventory *inv = players[consoleplayer].mo->InvSel;
 	if (inv != NULL)
 	{
@@ -577,6 +579,10 @@ void G_BuildTiccmd (ticcmd_t *cmd)
 
 	cmd->consistancy = consistancy[consoleplayer][(maketic/ticdup)%BACKUPTICS];
 
+	// A dedicated host only relays the clients' commands.
+	if (net_dedicated)
+		return;
+
 	strafe = Button_Strafe.bDown;
 	speed = Button_Speed.bDown ^ (int)cl_run;
 
@@ -911,7 +917,7 @@ static void ChangeSpy (int changespy)
 		{
 			pnum += step;
 			pnum &= MAXPLAYERS-1;
-			if (playeringame[pnum] &&
+			if (playeringame[pnum] && players[pnum].mo != NULL &&
 				(!checkTeam || players[pnum].mo->IsTeammate (players[consoleplayer].mo) ||
 				(bot_allowspy && players[pnum].Bot != NULL)))
 			{
@@ -1610,6 +1616,9 @@ void G_DeathMatchSpawnPlayer (int playernum)
 	unsigned int selections;
 	FPlayerStart *spot;
 
+	if (Net_IsDedicatedHost (playernum))
+		return;
+
 	selections = level.deathmatchstarts.Size ();
 	// [RH] We can get by with just 1 deathmatch start
 	if (selections < 1)
@@ -1747,6 +1756,10 @@ static void G_QueueBody (AActor *body)
 EXTERN_CVAR(Bool, sv_singleplayerrespawn)
 void G_DoReborn (int playernum, bool freshbot)
 {
+	// A dedicated host's slot is never given a pawn, so it never respawns.
+	if (Net_IsDedicatedHost (playernum))
+		return;
+
 	if (!multiplayer && !(level.flags2 & LEVEL2_ALLOWRESPAWN) && !sv_singleplayerrespawn)
 	{
 		if (BackupSaveName.Len() > 0 && FileExists (BackupSaveName.GetChars()))
@@ -2399,6 +2412,31 @@ void G_DoSaveGame (bool okForQuicksave, FString filename, const char *descriptio
 // DEMO RECORDING
 //
 
+// Every DEMOSYNCTICS tics the recording stores a checksum of the game
+// state, so playback can report where it stopped matching. Tics are
+// counted from the start of the demo, since gametic keeps running across
+// demos played or recorded in the same session.
+#define DEMOSYNCTICS TICRATE
+
+static int demostarttic;
+static int demodesynctic;
+
+static uint32_t G_DemoSyncSum ()
+{
+	uint32_t sum = FRandom::StaticSumSeeds ();
+
+	for (int i = 0; i < MAXPLAYERS; i++)
+	{
+		if (playeringame[i] && players[i].mo != NULL)
+		{
+			AActor *mo = players[i].mo;
+			sum = sum * 31 + int((mo->X() + mo->Y() + mo->Z())*257) + mo->Angles.Yaw.BAMs() + mo->Angles.Pitch.BAMs();
+			sum ^= players[i].health;
+		}
+	}
+	return sum;
+}
+
 void G_ReadDemoTiccmd (ticcmd_t *cmd, int player)
 {
 	int id = DEM_BAD;
@@ -2439,6 +2477,18 @@ void G_ReadDemoTiccmd (ticcmd_t *cmd, int player)
 			}
 			break;
 
+		case DEM_SYNCCHECK:
+			{
+				int tic = ReadLong (&demo_p);
+				uint32_t sum = ReadLong (&demo_p);
+				if (demodesynctic < 0 && (tic != gametic - demostarttic || sum != G_DemoSyncSum ()))
+				{
+					demodesynctic = tic;
+					Printf (TEXTCOLOR_RED "Demo desynced by tic %d\n", tic);
+				}
+			}
+			break;
+
 		default:
 			Net_DoCommand (id, &demo_p, player);
 			break;
@@ -2478,6 +2528,13 @@ void G_WriteDemoTiccmd (ticcmd_t *cmd, int player, int buf)
 		NetSpecs[player][buf].SetData (NULL, 0);
 	}
 
+	if (player == consoleplayer && (gametic - demostarttic) % DEMOSYNCTICS == 0)
+	{
+		WriteByte (DEM_SYNCCHECK, &demo_p);
+		WriteLong (gametic - demostarttic, &demo_p);
+		WriteLong (G_DemoSyncSum (), &demo_p);
+	}
+
 	// [RH] Now write out a "normal" ticcmd.
 	WriteUserCmdMessage (&cmd->ucmd, &players[player].cmd.ucmd, &demo_p);
 
@@ -2528,6 +2585,7 @@ void G_BeginRecording (const char *startmap)
 		startmap = level.MapName;
 	}
 	demo_p = demobuffer;
+	demostarttic = gametic;
 
 	WriteLong (FORM_ID, &demo_p);			// Write FORM ID
 	demo_p += 4;							// Leave space for len
@@ -2563,6 +2621,7 @@ void G_BeginRecording (const char *startmap)
 	if (multiplayer)
 	{
 		StartChunk (NETD_ID, &demo_p);
+		WriteByte (net_dedicatedhost, &demo_p);
 		FinishChunk (&demo_p);
 	}
 
@@ -2640,6 +2699,7 @@ bool G_ProcessIFFDemo (FString &mapname)
 	uint8_t *nextchunk;
 
 	demoplayback = true;
+	net_dedicatedhost = false;
 
 	for (i = 0; i < MAXPLAYERS; i++)
 		playeringame[i] = 0;
@@ -2721,6 +2781,10 @@ bool G_ProcessIFFDemo (FString &mapname)
 
 		case NETD_ID:
 			multiplayer = true;
+			if (len >= 1)
+			{
+				net_dedicatedhost = !!ReadByte (&demo_p);
+			}
 			break;
 
 		case WEAP_ID:
@@ -2787,6 +2851,8 @@ void G_DoPlayDemo (void)
 	int demolump;
 
 	gameaction = ga_nothing;
+	demostarttic = gametic;
+	demodesynctic = -1;
 
 	// [RH] Allow for demos not loaded as lumps
 	demolump = Wads.CheckNumForFullName (defdemoname, true);
@@ -2862,6 +2928,10 @@ void G_TimeDemo (const char* name)
 	noblit = !!Args->CheckParm ("-noblit");
 	timingdemo = true;
 	singletics = true;
+	if (Args->CheckValue("-acsprofile") != NULL)
+	{
+		acs_profiletime = true;
+	}
 
 	defdemoname = name;
 	gameaction = (gameaction == ga_loadgame) ? ga_loadgameplaydemo : ga_playdemo;
@@ -2901,6 +2971,7 @@ bool G_CheckDemoStatus (void)
 		demoplayback = false;
 		netgame = false;
 		multiplayer = false;
+		net_dedicatedhost = false;
 		singletics = false;
 		for (int i = 1; i < MAXPLAYERS; i++)
 			playeringame[i] = 0;
@@ -2917,6 +2988,17 @@ bool G_CheckDemoStatus (void)
 				// Trying to get back to a stable state after timing a demo
 				// seems to cause problems. I don't feel like fixing that
 				// right now.
+				const char *acsdump = Args->CheckValue("-acsprofile");
+				if (acsdump != NULL)
+				{
+					P_DumpACSProfile(acsdump);
+				}
+				if (demodesynctic >= 0)
+				{
+					I_FatalError ("timed %i gametics in %i realtics (%.1f fps)\n"
+								  "Demo desynced by tic %d.", gametic,
+								  endtime, (float)gametic/(float)endtime*(float)TICRATE, demodesynctic);
+				}
 				I_FatalError ("timed %i gametics in %i realtics (%.1f fps)\n"
 							  "(This is not really an error.)", gametic,
 							  endtime, (float)gametic/(float)endtime*(float)TICRATE);
@@ -638,7 +638,7 @@ void G_ChangeLevel(const char *levelname, int position, int flags, int nextSkill
 
 	for(int i = 0; i < MAXPLAYERS; i++)
 	{
-		if (playeringame[i])
+		if (playeringame[i] && !Net_IsDedicatedHost(i))
 		{
 			player_t *player = &players[i];
 
@@ -817,7 +817,7 @@ void G_DoCompleted (void)
 
 	for (i = 0; i < MAXPLAYERS; i++)
 	{
-		if (playeringame[i])
+		if (playeringame[i] && !Net_IsDedicatedHost(i))
 		{ // take away appropriate inventory
 			G_PlayerFinishLevel (i, mode, changeflags);
 		}
@@ -1030,7 +1030,7 @@ void G_DoLoadLevel (int position, bool autosave)
 	// For each player, if they are viewing through a player, make sure it is themselves.
 	for (int ii = 0; ii < MAXPLAYERS; ++ii)
 	{
-		if (playeringame[ii])
+		if (playeringame[ii] && !Net_IsDedicatedHost(ii))
 		{
 			if (players[ii].camera == NULL || players[ii].camera->player != NULL)
 			{
@@ -1099,8 +1099,14 @@ void G_WorldDone (void)
 		// Strife needs a special case here to choose between good and sad ending. Bad is handled elsewhere.
 		if (endsequence == NAME_Inter_Strife)
 		{
-			if (players[0].mo->FindInventory (NAME_QuestItem25) ||
-				players[0].mo->FindInventory (NAME_QuestItem28))
+			// The first player with a pawn decides; slot 0 may be a dedicated host.
+			AActor *pawn = NULL;
+			for (int i = 0; i < MAXPLAYERS && pawn == NULL; ++i)
+			{
+				if (playeringame[i]) pawn = players[i].mo;
+			}
+			if (pawn != NULL && (pawn->FindInventory (NAME_QuestItem25) ||
+				pawn->FindInventory (NAME_QuestItem28)))
 			{
 				endsequence = NAME_Inter_Strife_Good;
 			}
@@ -1204,7 +1210,7 @@ void G_StartTravel ()
 			players[i].camera = NULL;
 
 			// Only living players travel. Dead ones get a new body on the new level.
-			if (players[i].health > 0)
+			if (pawn != NULL && players[i].health > 0)
 			{
 				pawn->UnlinkFromWorld (nullptr);
 				int tid = pawn->tid;	// Save TID
@@ -79,6 +79,7 @@ struct FLevelLocals
 	TArray<node_t> gamenodes;
 	node_t *headgamenode;
 	TArray<uint8_t> rejectmatrix;
+	TArray<int> sightgroups;		// used instead of an empty REJECT: sectors in different groups cannot see each other
 
 	TArray<FSectorPortal> sectorPortals;
 	TArray<zone_t>	Zones;
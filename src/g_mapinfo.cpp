@@ -355,7 +355,7 @@ level_info_t *level_info_t::CheckLevelRedirect ()
 		{
 			for (int i = 0; i < MAXPLAYERS; ++i)
 			{
-				if (playeringame[i] && players[i].mo->FindInventory(type))
+				if (playeringame[i] && players[i].mo != NULL && players[i].mo->FindInventory(type))
 				{
 					// check for actual presence of the map.
 					if (P_CheckMapData(RedirectMapName))
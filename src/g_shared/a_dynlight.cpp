@@ -452,6 +452,11 @@ size_t ADynamicLight::PointerSubstitution (DObject *old, DObject *notOld)
 //
 //=============================================================================
 
+// Lights attached to projectiles and flickering decorations get relinked
+// all the time, so the nodes are kept on a freelist instead of going back
+// to the heap.
+static FLightNode *FreeLightNodes;
+
 FLightNode * AddLightNode(FLightNode ** thread, void * linkto, ADynamicLight * light, FLightNode *& nextnode)
 {
 	FLightNode * node;
@@ -470,7 +475,15 @@ FLightNode * AddLightNode(FLightNode ** thread, void * linkto, ADynamicLight * l
 	// Couldn't find an existing node for this sector. Add one at the head
 	// of the list.
 	
-	node = new FLightNode;
+	if (FreeLightNodes != NULL)
+	{
+		node = FreeLightNodes;
+		FreeLightNodes = node->nextTarget;
+	}
+	else
+	{
+		node = new FLightNode;
+	}
 	
 	node->targ = linkto;
 	node->lightsource = light; 
@@ -513,7 +526,8 @@ static FLightNode * DeleteLightNode(FLightNode * node)
 		
 		// Return this node to the freelist
 		tn=node->nextTarget;
-		delete node;
+		node->nextTarget = FreeLightNodes;
+		FreeLightNodes = node;
 		return(tn);
     }
 	return(NULL);
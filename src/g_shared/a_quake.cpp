@@ -137,7 +137,7 @@ void DEarthquake::Tick ()
 	{
 		for (i = 0; i < MAXPLAYERS; i++)
 		{
-			if (playeringame[i] && !(players[i].cheats & CF_NOCLIP))
+			if (playeringame[i] && players[i].mo != NULL && !(players[i].cheats & CF_NOCLIP))
 			{
 				AActor *victim = players[i].mo;
 				double dist;
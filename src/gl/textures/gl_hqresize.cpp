@@ -55,6 +55,10 @@
 
 #ifdef GZ_USE_LIBDISPATCH
 #	include <dispatch/dispatch.h>
+#else
+#	include <atomic>
+#	include <thread>
+#	include <vector>
 #endif // GZ_USE_LIBDISPATCH
 
 CUSTOM_CVAR(Int, gl_texture_hqresize, 0, CVAR_ARCHIVE | CVAR_GLOBALCONFIG | CVAR_NOINITCALL)
@@ -87,7 +91,6 @@ CVAR (Flag, gl_texture_hqresize_textures, gl_texture_hqresize_targets, 1);
 CVAR (Flag, gl_texture_hqresize_sprites, gl_texture_hqresize_targets, 2);
 CVAR (Flag, gl_texture_hqresize_fonts, gl_texture_hqresize_targets, 4);
 
-#ifdef GZ_USE_LIBDISPATCH
 CVAR(Bool, gl_texture_hqresize_multithread, true, CVAR_ARCHIVE | CVAR_GLOBALCONFIG);
 
 CUSTOM_CVAR(Int, gl_texture_hqresize_mt_width, 16, CVAR_ARCHIVE | CVAR_GLOBALCONFIG)
@@ -101,7 +104,6 @@ CUSTOM_CVAR(Int, gl_texture_hqresize_mt_height, 4, CVAR_ARCHIVE | CVAR_GLOBALCON
 	if (self < 2)    self = 2;
 	if (self > 1024) self = 1024;
 }
-#endif // GZ_USE_LIBDISPATCH
 
 
 static void scale2x ( uint32_t* inputBuffer, uint32_t* outputBuffer, int inWidth, int inHeight )
@@ -289,7 +291,6 @@ static unsigned char *xbrzHelper( void (*xbrzFunction) ( size_t, const uint32_t*
 
 	unsigned char * newBuffer = new unsigned char[outWidth*outHeight*4];
 	
-#ifdef GZ_USE_LIBDISPATCH
 	const int thresholdWidth  = gl_texture_hqresize_mt_width;
 	const int thresholdHeight = gl_texture_hqresize_mt_height;
 	
@@ -297,6 +298,7 @@ static unsigned char *xbrzHelper( void (*xbrzFunction) ( size_t, const uint32_t*
 		&& inWidth  > thresholdWidth
 		&& inHeight > thresholdHeight)
 	{
+#ifdef GZ_USE_LIBDISPATCH
 		const dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
 		
 		dispatch_apply(inHeight / thresholdHeight + 1, queue, ^(size_t sliceY)
@@ -304,9 +306,33 @@ static unsigned char *xbrzHelper( void (*xbrzFunction) ( size_t, const uint32_t*
 			xbrzFunction(N, reinterpret_cast<uint32_t*>(inputBuffer), reinterpret_cast<uint32_t*>(newBuffer),
 				inWidth, inHeight, xbrz::ARGB, xbrz::ScalerCfg(), sliceY * thresholdHeight, (sliceY + 1) * thresholdHeight);
 		});
+#else
+		// Each worker takes the next unscaled slice until none are left.
+		const int numSlices = inHeight / thresholdHeight + 1;
+		std::atomic<int> nextSlice(0);
+		auto scaleSlices = [&]()
+		{
+			for (int sliceY = nextSlice++; sliceY < numSlices; sliceY = nextSlice++)
+			{
+				xbrzFunction(N, reinterpret_cast<uint32_t*>(inputBuffer), reinterpret_cast<uint32_t*>(newBuffer),
+					inWidth, inHeight, xbrz::ARGB, xbrz::ScalerCfg(), sliceY * thresholdHeight, (sliceY + 1) * thresholdHeight);
+			}
+		};
+
+		const int numThreads = MIN<int>(numSlices, MAX<int>(std::thread::hardware_concurrency(), 1)) - 1;
+		std::vector<std::thread> threads;
+		for (int i = 0; i < numThreads; i++)
+		{
+			threads.emplace_back(scaleSlices);
+		}
+		scaleSlices();
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+#endif // GZ_USE_LIBDISPATCH
 	}
 	else
-#endif // GZ_USE_LIBDISPATCH
 	{
 		xbrzFunction(N, reinterpret_cast<uint32_t*>(inputBuffer), reinterpret_cast<uint32_t*>(newBuffer),
 			inWidth, inHeight, xbrz::ARGB, xbrz::ScalerCfg(), 0, std::numeric_limits<int>::max());
@@ -210,7 +210,7 @@ void HU_GetPlayerWidths(int &maxnamewidth, int &maxscorewidth, int &maxiconheigh
 			{
 				maxnamewidth = width;
 			}
-			if (players[i].mo->ScoreIcon.isValid())
+			if (players[i].mo != NULL && players[i].mo->ScoreIcon.isValid())
 			{
 				FTexture *pic = TexMan[players[i].mo->ScoreIcon];
 				width = pic->GetScaledWidth() - pic->GetScaledLeftOffset() + 2;
@@ -423,7 +423,7 @@ static void HU_DrawPlayer (player_t *player, bool highlight, int col1, int col2,
 	screen->DrawText (SmallFont, color, col2, y + ypadding, player->playerstate == PST_DEAD && !deathmatch ? "DEAD" : str,
 		DTA_CleanNoMove, true, TAG_DONE);
 
-	if (player->mo->ScoreIcon.isValid())
+	if (player->mo != NULL && player->mo->ScoreIcon.isValid())
 	{
 		FTexture *pic = TexMan[player->mo->ScoreIcon];
 		screen->DrawTexture (pic, col3, y,
@@ -655,17 +655,25 @@ bool Host_SendAllHere (void *userdata)
 	return gotack[MAXNETNODES] == doomcom.numnodes - 1;
 }
 
-void HostGame (int i)
+static int HostPlayerCount (int i)
 {
-	PreGamePacket packet;
 	int numplayers;
-	int node;
-	int gotack[MAXNETNODES+1];
 
 	if ((i == Args->NumArgs() - 1) || !(numplayers = atoi (Args->GetArg(i+1))))
 	{	// No player count specified, assume 2
 		numplayers = 2;
 	}
+	return numplayers;
+}
+
+void HostGame (int i)
+{
+	PreGamePacket packet;
+	int numplayers;
+	int node;
+	int gotack[MAXNETNODES+1];
+
+	numplayers = HostPlayerCount (i);
 
 	if (numplayers > MAXNETNODES)
 	{
@@ -937,6 +945,20 @@ static bool NodesOnSameNetwork()
 	return true;
 }
 
+//
+// I_CheckDedicatedHost
+//
+// Returns true if -dedicated will start a network game. Video and sound
+// are set up before I_InitNetwork runs, so they need to know early.
+// HostGame treats a single player as a normal local game.
+//
+bool I_CheckDedicatedHost (void)
+{
+	int i = Args->CheckParm ("-dedicated");
+
+	return i != 0 && HostPlayerCount (i) != 1;
+}
+
 //
 // I_InitNetwork
 //
@@ -969,8 +991,18 @@ bool I_InitNetwork (void)
 
 	// parse network game options,
 	//		player 1: -host <numplayers>
+	//		          -dedicated <numplayers> (headless packet server)
 	//		player x: -join <player 1's address>
-	if ( (i = Args->CheckParm ("-host")) )
+	if ( (i = Args->CheckParm ("-dedicated")) )
+	{
+		HostGame (i);
+		net_dedicated = netgame;
+		if (net_dedicated)
+		{
+			return true;
+		}
+	}
+	else if ( (i = Args->CheckParm ("-host")) )
 	{
 		HostGame (i);
 	}
@@ -3,6 +3,7 @@
 
 // Called by D_DoomMain.
 bool I_InitNetwork (void);
+bool I_CheckDedicatedHost (void);
 void I_NetCmd (void);
 
 #endif
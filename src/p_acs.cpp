@@ -63,6 +63,7 @@
 #include "gstrings.h"
 #include "gi.h"
 #include "g_game.h"
+#include "d_net.h"
 #include "sc_man.h"
 #include "c_bind.h"
 #include "info.h"
@@ -554,6 +555,9 @@ extern FILE *Logfile;
 
 FRandom pr_acs ("ACS");
 
+// Adds wall time to the instruction counts shown by acsprofile.
+CVAR (Bool, acs_profiletime, false, 0)
+
 // I imagine this much stack space is probably overkill, but it could
 // potentially get used with recursive functions.
 #define STACK_SIZE 4096
@@ -1734,7 +1738,7 @@ static void ClearInventory (AActor *activator)
 	{
 		for (int i = 0; i < MAXPLAYERS; ++i)
 		{
-			if (playeringame[i])
+			if (playeringame[i] && players[i].mo != NULL)
 				players[i].mo->ClearInventory();
 		}
 	}
@@ -1777,7 +1781,7 @@ static void GiveInventory (AActor *activator, const char *type, int amount)
 	{
 		for (int i = 0; i < MAXPLAYERS; ++i)
 		{
-			if (playeringame[i])
+			if (playeringame[i] && players[i].mo != NULL)
 				players[i].mo->GiveInventory(info, amount);
 		}
 	}
@@ -1820,7 +1824,7 @@ static void TakeInventory (AActor *activator, const char *type, int amount)
 	{
 		for (int i = 0; i < MAXPLAYERS; ++i)
 		{
-			if (playeringame[i])
+			if (playeringame[i] && players[i].mo != NULL)
 				players[i].mo->TakeInventory(info, amount);
 		}
 	}
@@ -1889,7 +1893,7 @@ static int UseInventory (AActor *activator, const char *type)
 	{
 		for (int i = 0; i < MAXPLAYERS; ++i)
 		{
-			if (playeringame[i])
+			if (playeringame[i] && players[i].mo != NULL)
 				ret += DoUseInv (players[i].mo, info);
 		}
 	}
@@ -3863,7 +3867,7 @@ int DLevelScript::CountPlayers ()
 	int count = 0, i;
 
 	for (i = 0; i < MAXPLAYERS; i++)
-		if (playeringame[i])
+		if (playeringame[i] && !Net_IsDedicatedHost(i))
 			count++;
 
 	return count;
@@ -6879,6 +6883,51 @@ inline int getshort (int *&pc)
 	return res;
 }
 
+//==========================================================================
+//
+// FuseConditionalJump
+//
+// Compares are nearly always followed by PCD_IFGOTO or PCD_IFNOTGOTO. In
+// that case the jump is done right here, saving the push of the result and
+// another trip through the dispatch switch. The runaway counter is kept
+// the same as if both instructions had run on their own.
+//
+//==========================================================================
+
+static inline bool FuseConditionalJump(FBehavior *module, ACSFormat fmt, int *&pc, unsigned int &runaway, bool cond)
+{
+	int *next;
+	int pcd;
+
+	// Both jumps are below 240, so they are a single byte in the packed format.
+	if (fmt == ACS_LittleEnhanced)
+	{
+		pcd = *(uint8_t *)pc;
+		next = (int *)((uint8_t *)pc + 1);
+	}
+	else
+	{
+		pcd = LittleLong(*pc);
+		next = pc + 1;
+	}
+
+	if (pcd == PCD_IFNOTGOTO)
+	{
+		cond = !cond;
+	}
+	else if (pcd != PCD_IFGOTO)
+	{
+		return false;
+	}
+	if (runaway + 1 > 2000000)
+	{ // Let the main loop terminate the script at the exact same spot.
+		return false;
+	}
+	runaway++;
+	pc = cond ? module->Ofs2PC (LittleLong(*next)) : next + 1;
+	return true;
+}
+
 static bool CharArrayParms(int &capacity, int &offset, int &a, int *Stack, int &sp, bool ranged)
 {
 	if (ranged)
@@ -7014,6 +7063,18 @@ int DLevelScript::RunScript ()
 	const char *lookup;
 	int optstart = -1;
 	int temp;
+	// Reading the clock costs more than many ACS instructions, so the wall
+	// time is only taken when asked for. Functions cannot be suspended, so
+	// every call made here also returns here.
+	const bool timing = acs_profiletime;
+	cycle_t runtime;
+	TArray<cycle_t> calltimes;
+
+	runtime.Reset();
+	if (timing)
+	{
+		runtime.Clock();
+	}
 
 	while (state == SCRIPT_Running)
 	{
@@ -7337,6 +7398,12 @@ int DLevelScript::RunScript ()
 				::new(&Stack[sp]) CallReturn(activeBehavior->PC2Ofs(pc), activeFunction,
 					activeBehavior, mylocals, localarrays, pcd == PCD_CALLDISCARD, runaway);
 				sp += (sizeof(CallReturn) + sizeof(int) - 1) / sizeof(int);
+				if (timing)
+				{
+					cycle_t &calltime = calltimes[calltimes.Reserve(1)];
+					calltime.Reset();
+					calltime.Clock();
+				}
 				pc = module->Ofs2PC (func->Address);
 				localarrays = &func->LocalArrays;
 				activeFunction = func;
@@ -7365,7 +7432,16 @@ int DLevelScript::RunScript ()
 				}
 				sp -= sizeof(CallReturn)/sizeof(int);
 				retsp = &Stack[sp];
-				activeBehavior->GetFunctionProfileData(activeFunction)->AddRun(runaway - ret->EntryInstrCount);
+				{
+					double ms = 0;
+					cycle_t calltime;
+					if (calltimes.Pop(calltime))
+					{
+						calltime.Unclock();
+						ms = calltime.TimeMS();
+					}
+					activeBehavior->GetFunctionProfileData(activeFunction)->AddRun(runaway - ret->EntryInstrCount, ms);
+				}
 				sp = int(locals - Stack);
 				pc = ret->ReturnModule->Ofs2PC(ret->ReturnAddress);
 				activeFunction = ret->ReturnFunction;
@@ -7421,33 +7497,37 @@ int DLevelScript::RunScript ()
 			break;
 
 		case PCD_EQ:
-			STACK(2) = (STACK(2) == STACK(1));
-			sp--;
-			break;
+			temp = (STACK(2) == STACK(1));
+			goto compare;
 
 		case PCD_NE:
-			STACK(2) = (STACK(2) != STACK(1));
-			sp--;
-			break;
+			temp = (STACK(2) != STACK(1));
+			goto compare;
 
 		case PCD_LT:
-			STACK(2) = (STACK(2) < STACK(1));
-			sp--;
-			break;
+			temp = (STACK(2) < STACK(1));
+			goto compare;
 
 		case PCD_GT:
-			STACK(2) = (STACK(2) > STACK(1));
-			sp--;
-			break;
+			temp = (STACK(2) > STACK(1));
+			goto compare;
 
 		case PCD_LE:
-			STACK(2) = (STACK(2) <= STACK(1));
-			sp--;
-			break;
+			temp = (STACK(2) <= STACK(1));
+			goto compare;
 
 		case PCD_GE:
-			STACK(2) = (STACK(2) >= STACK(1));
-			sp--;
+			temp = (STACK(2) >= STACK(1));
+compare:
+			if (FuseConditionalJump(activeBehavior, fmt, pc, runaway, temp != 0))
+			{
+				sp -= 2;
+			}
+			else
+			{
+				STACK(2) = temp;
+				sp--;
+			}
 			break;
 
 		case PCD_ASSIGNSCRIPTVAR:
@@ -10451,13 +10531,17 @@ scriptwait:
 			break;
  		}
  	}
+	if (timing)
+	{
+		runtime.Unclock();
+	}
 
 	if (runaway != 0 && InModuleScriptNumber >= 0)
 	{
 		auto scriptptr = activeBehavior->GetScriptPtr(InModuleScriptNumber);
 		if (scriptptr != nullptr)
 		{
-			scriptptr->ProfileData.AddRun(runaway);
+			scriptptr->ProfileData.AddRun(runaway, runtime.TimeMS());
 		}
 		else
 		{
@@ -10776,12 +10860,22 @@ void ACSProfileInfo::Reset()
 	NumRuns = 0;
 	MinInstrPerRun = UINT_MAX;
 	MaxInstrPerRun = 0;
+	TotalMS = 0;
+	MaxMSPerRun = 0;
 }
 
-void ACSProfileInfo::AddRun(unsigned int num_instr)
+// The time includes everything the script called, like spawning actors or
+// running specials, so it shows the real cost of a run better than the
+// instruction count.
+void ACSProfileInfo::AddRun(unsigned int num_instr, double ms)
 {
 	TotalInstr += num_instr;
+	TotalMS += ms;
 	NumRuns++;
+	if (ms > MaxMSPerRun)
+	{
+		MaxMSPerRun = ms;
+	}
 	if (num_instr < MinInstrPerRun)
 	{
 		MinInstrPerRun = num_instr;
@@ -10880,6 +10974,37 @@ static int sort_by_runs(const void *a_, const void *b_)
 	return b->ProfileData->NumRuns - a->ProfileData->NumRuns;
 }
 
+static int sort_by_time(const void *a_, const void *b_)
+{
+	const ProfileCollector *a = (const ProfileCollector *)a_;
+	const ProfileCollector *b = (const ProfileCollector *)b_;
+
+	double diff = b->ProfileData->TotalMS - a->ProfileData->TotalMS;
+	return diff > 0 ? 1 : diff < 0 ? -1 : 0;
+}
+
+static void GetProfileName(ProfileCollector *prof, bool functions, char *scriptname, size_t len)
+{
+	if (functions)
+	{
+		uint32_t *fnames = (uint32_t *)prof->Module->FindChunk(MAKE_ID('F','N','A','M'));
+		if (fnames != NULL && prof->Index >= 0 && prof->Index < (int)LittleLong(fnames[2]))
+		{
+			mysnprintf(scriptname, len, "%s",
+				(char *)(fnames + 2) + LittleLong(fnames[3+prof->Index]));
+		}
+		else
+		{
+			mysnprintf(scriptname, len, "Function %d", prof->Index);
+		}
+	}
+	else
+	{
+		mysnprintf(scriptname, len, "%s",
+			ScriptPresentation(prof->Module->GetScriptPtr(prof->Index)->Number).GetChars() + 7);
+	}
+}
+
 static void ShowProfileData(TArray<ProfileCollector> &profiles, long ilimit,
 	int (*sorter)(const void *, const void *), bool functions)
 {
@@ -10907,8 +11032,8 @@ static void ShowProfileData(TArray<ProfileCollector> &profiles, long ilimit,
 		limit = UINT_MAX;
 	}
 
-	Printf(TEXTCOLOR_YELLOW "Module       %-20s      Total    Runs     Avg     Min     Max\n", typelabels[functions]);
-	Printf(TEXTCOLOR_YELLOW "------------ -------------------- ---------- ------- ------- ------- -------\n");
+	Printf(TEXTCOLOR_YELLOW "Module       %-20s      Total    Runs     Avg     Min     Max   Time ms  Max ms\n", typelabels[functions]);
+	Printf(TEXTCOLOR_YELLOW "------------ -------------------- ---------- ------- ------- ------- ------- --------- -------\n");
 	for (unsigned int i = 0; i < limit && i < profiles.Size(); ++i)
 	{
 		ProfileCollector *prof = &profiles[i];
@@ -10921,35 +11046,93 @@ static void ShowProfileData(TArray<ProfileCollector> &profiles, long ilimit,
 		mysnprintf(modname, sizeof(modname), "%s", prof->Module->GetModuleName());
 
 		// Script/function name
-		if (functions)
-		{
-			uint32_t *fnames = (uint32_t *)prof->Module->FindChunk(MAKE_ID('F','N','A','M'));
-			if (prof->Index >= 0 && prof->Index < (int)LittleLong(fnames[2]))
-			{
-				mysnprintf(scriptname, sizeof(scriptname), "%s",
-					(char *)(fnames + 2) + LittleLong(fnames[3+prof->Index]));
-			}
-			else
-			{
-				mysnprintf(scriptname, sizeof(scriptname), "Function %d", prof->Index);
-			}
-		}
-		else
-		{
-			mysnprintf(scriptname, sizeof(scriptname), "%s",
-				ScriptPresentation(prof->Module->GetScriptPtr(prof->Index)->Number).GetChars() + 7);
-		}
-		Printf("%-12s %-20s%11llu%8u%8u%8u%8u\n",
+		GetProfileName(prof, functions, scriptname, sizeof(scriptname));
+		Printf("%-12s %-20s%11llu%8u%8u%8u%8u%10.2f%8.2f\n",
 			modname, scriptname,
 			prof->ProfileData->TotalInstr,
 			prof->ProfileData->NumRuns,
 			unsigned(prof->ProfileData->TotalInstr / prof->ProfileData->NumRuns),
 			prof->ProfileData->MinInstrPerRun,
-			prof->ProfileData->MaxInstrPerRun
+			prof->ProfileData->MaxInstrPerRun,
+			prof->ProfileData->TotalMS,
+			prof->ProfileData->MaxMSPerRun
 			);
 	}
 }
 
+//==========================================================================
+//
+// P_DumpACSProfile
+//
+// Writes everything that has run so far to a CSV file, one line per
+// script or function. Used by `acsprofile dump` and -acsprofile.
+//
+//==========================================================================
+
+static void DumpCSVString(FILE *f, const char *str)
+{
+	fputc('"', f);
+	for (; *str != 0; str++)
+	{
+		if (*str == '"') fputc('"', f);
+		fputc(*str, f);
+	}
+	fputc('"', f);
+}
+
+static void DumpProfileData(FILE *f, TArray<ProfileCollector> &profiles, bool functions)
+{
+	char scriptname[256];
+
+	for (auto &prof : profiles)
+	{
+		if (prof.ProfileData->NumRuns == 0)
+		{
+			continue;
+		}
+		GetProfileName(&prof, functions, scriptname, sizeof(scriptname));
+		fprintf(f, "%s,", functions ? "function" : "script");
+		DumpCSVString(f, prof.Module->GetModuleName());
+		fputc(',', f);
+		DumpCSVString(f, scriptname);
+		fprintf(f, ",%llu,%u,%u,%u,%.4f,%.4f\n",
+			prof.ProfileData->TotalInstr,
+			prof.ProfileData->NumRuns,
+			prof.ProfileData->MinInstrPerRun,
+			prof.ProfileData->MaxInstrPerRun,
+			prof.ProfileData->TotalMS,
+			prof.ProfileData->MaxMSPerRun);
+	}
+}
+
+bool P_DumpACSProfile(const char *filename)
+{
+	TArray<ProfileCollector> ScriptProfiles, FuncProfiles;
+	FILE *f = fopen(filename, "w");
+
+	if (f == NULL)
+	{
+		Printf("Could not open %s for writing\n", filename);
+		return false;
+	}
+	ArrangeScriptProfiles(ScriptProfiles);
+	ArrangeFunctionProfiles(FuncProfiles);
+	if (ScriptProfiles.Size() > 0)
+	{
+		qsort(&ScriptProfiles[0], ScriptProfiles.Size(), sizeof(ProfileCollector), sort_by_time);
+	}
+	if (FuncProfiles.Size() > 0)
+	{
+		qsort(&FuncProfiles[0], FuncProfiles.Size(), sizeof(ProfileCollector), sort_by_time);
+	}
+
+	fprintf(f, "type,module,name,total,runs,min,max,timems,maxms\n");
+	DumpProfileData(f, ScriptProfiles, false);
+	DumpProfileData(f, FuncProfiles, true);
+	fclose(f);
+	return true;
+}
+
 CCMD(acsprofile)
 {
 	static int (*sort_funcs[])(const void*, const void *) =
@@ -10958,10 +11141,11 @@ CCMD(acsprofile)
 		sort_by_min,
 		sort_by_max,
 		sort_by_avg,
-		sort_by_runs
+		sort_by_runs,
+		sort_by_time
 	};
-	static const char *sort_names[] = { "total", "min", "max", "avg", "runs" };
-	static const uint8_t sort_match_len[] = {   1,     2,     2,     1,      1 };
+	static const char *sort_names[] = { "total", "min", "max", "avg", "runs", "time" };
+	static const uint8_t sort_match_len[] = {   1,     2,     2,     1,      1,      2 };
 
 	TArray<ProfileCollector> ScriptProfiles, FuncProfiles;
 	long limit = 10;
@@ -10981,6 +11165,22 @@ CCMD(acsprofile)
 			ClearProfiles(FuncProfiles);
 			return;
 		}
+		// `acsprofile dump <file>` writes all profiling information to a CSV file.
+		if (stricmp(argv[1], "dump") == 0)
+		{
+			if (argv.argc() > 2)
+			{
+				if (P_DumpACSProfile(argv[2]))
+				{
+					Printf("ACS profile written to %s\n", argv[2]);
+				}
+			}
+			else
+			{
+				Printf("acsprofile dump <filename> : Write profiling information to a CSV file\n");
+			}
+			return;
+		}
 		for (int i = 1; i < argv.argc(); ++i)
 		{
 			// If it's a number, set the display limit.
@@ -11011,7 +11211,9 @@ CCMD(acsprofile)
 			{
 				Printf("Unknown option '%s'\n", argv[i]);
 				Printf("acsprofile clear : Reset profiling information\n");
-				Printf("acsprofile [total|min|max|avg|runs] [<limit>]\n");
+				Printf("acsprofile dump <filename> : Write profiling information to a CSV file\n");
+				Printf("acsprofile [total|min|max|avg|runs|time] [<limit>]\n");
+				Printf("Times are only recorded while acs_profiletime is on\n");
 				return;
 			}
 		}
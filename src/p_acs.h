@@ -127,6 +127,7 @@ void P_CollectACSGlobalStrings();
 void P_ReadACSVars(FSerializer &);
 void P_WriteACSVars(FSerializer &);
 void P_ClearACSVars(bool);
+bool P_DumpACSProfile(const char *filename);
 
 struct ACSProfileInfo
 {
@@ -134,9 +135,11 @@ struct ACSProfileInfo
 	unsigned int NumRuns;
 	unsigned int MinInstrPerRun;
 	unsigned int MaxInstrPerRun;
+	double TotalMS;
+	double MaxMSPerRun;
 
 	ACSProfileInfo();
-	void AddRun(unsigned int num_instr);
+	void AddRun(unsigned int num_instr, double ms);
 	void Reset();
 };
 
@@ -3443,7 +3443,7 @@ bool CheckBossDeath (AActor *actor)
 
 	// make sure there is a player alive for victory
 	for (i = 0; i < MAXPLAYERS; i++)
-		if (playeringame[i] && players[i].health > 0)
+		if (playeringame[i] && players[i].health > 0 && players[i].mo != NULL)
 			break;
 	
 	if (i == MAXPLAYERS)
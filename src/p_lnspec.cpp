@@ -3037,7 +3037,7 @@ FUNC(LS_SetPlayerProperty)
 			if (arg1)
 			{
 				players[i].cheats |= mask;
-				if (arg2 == PROP_FLY)
+				if (arg2 == PROP_FLY && players[i].mo != NULL)
 				{
 					players[i].mo->flags2 |= MF2_FLY;
 					players[i].mo->flags |= MF_NOGRAVITY;
@@ -3046,7 +3046,7 @@ FUNC(LS_SetPlayerProperty)
 			else
 			{
 				players[i].cheats &= ~mask;
-				if (arg2 == PROP_FLY)
+				if (arg2 == PROP_FLY && players[i].mo != NULL)
 				{
 					players[i].mo->flags2 &= ~MF2_FLY;
 					players[i].mo->flags &= ~MF_NOGRAVITY;
@@ -3269,7 +3269,7 @@ FUNC(LS_GlassBreak)
 			{
 				for (int i = 0; i < MAXPLAYERS; ++i)
 				{
-					if (playeringame[i])
+					if (playeringame[i] && players[i].mo != NULL)
 					{
 						it = players[i].mo;
 						break;
@@ -431,6 +431,7 @@ DEFINE_ACTION_FUNCTION(AActor, FindFloorCeiling)
 // Debug CCMD for checking errors in the MultiBlockLinesIterator (needs to be removed when this code is complete)
 CCMD(ffcf)
 {
+	if (players[0].mo == NULL) return;
 	ffcf_verbose = true;
 	P_FindFloorCeiling(players[0].mo, 0);
 	ffcf_verbose = false;
@@ -1797,6 +1798,7 @@ bool P_CheckPosition(AActor *thing, const DVector2 &pos, FCheckPosition &tm, boo
 	FPortalGroupArray pcheck;
 	FMultiBlockThingsIterator it2(pcheck, pos.X, pos.Y, thing->Z(), thing->Height, thing->radius, false, newsec);
 	FMultiBlockThingsIterator::CheckResult tcres;
+	it2.SetCollisionFilter(MF_SOLID | MF_SPECIAL | MF_SHOOTABLE, MF6_TOUCHY);
 
 	while ((it2.Next(&tcres)))
 	{
@@ -2010,6 +2012,7 @@ bool P_TestMobjZ(AActor *actor, bool quick, AActor **pOnmobj)
 	FPortalGroupArray check;
 	FMultiBlockThingsIterator it(check, actor, -1, true);
 	FMultiBlockThingsIterator::CheckResult cres;
+	it.SetCollisionFilter(MF_SOLID, 0);
 
 	while (it.Next(&cres))
 	{
@@ -5637,6 +5640,11 @@ int P_RadiusAttack(AActor *bombspot, AActor *bombsource, int bombdamage, int bom
 	FPortalGroupArray grouplist(FPortalGroupArray::PGA_Full3d);
 	FMultiBlockThingsIterator it(grouplist, bombspot->X(), bombspot->Y(), bombspot->Z() - bombdistance, bombspot->Height + bombdistance*2, bombdistance, false, bombspot->Sector);
 	FMultiBlockThingsIterator::CheckResult cres;
+	// Vulnerable actors can be damaged by radius attacks even if not shootable
+	// Used to emulate MBF's vulnerability of non-missile bouncers to explosions.
+	// Only the flags can be checked up front. Things out of range can still
+	// be hit with a negative RadiusDamageFactor or MF7_FORCEZERORADIUSDMG.
+	it.SetCollisionFilter(MF_SHOOTABLE, MF6_VULNERABLE, false);
 
 	if (flags & RADF_SOURCEISSPOT)
 	{ // The source is actually the same as the spot, even if that wasn't what we received.
@@ -5647,10 +5655,6 @@ int P_RadiusAttack(AActor *bombspot, AActor *bombsource, int bombdamage, int bom
 	while ((it.Next(&cres)))
 	{
 		AActor *thing = cres.thing;
-		// Vulnerable actors can be damaged by radius attacks even if not shootable
-		// Used to emulate MBF's vulnerability of non-missile bouncers to explosions.
-		if (!((thing->flags & MF_SHOOTABLE) || (thing->flags6 & MF6_VULNERABLE)))
-			continue;
 
 		// Boss spider and cyborg and Heretic's ep >= 2 bosses
 		// take no damage from concussion.
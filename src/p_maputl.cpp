@@ -899,6 +899,25 @@ bool FMultiBlockLinesIterator::Next(FMultiBlockLinesIterator::CheckResult *item)
 	return Next(item);
 }
 
+//===========================================================================
+//
+// In crowds most things in the blocks are corpses or too far away to touch
+// the mover. This skips things without any of the given flags and, if
+// requested, things out of reach of the check radius before they are handed
+// out, so the caller does not have to look at each of them. The distance
+// check is only done without portals, where all positions are in the same
+// space and no offsetting is needed.
+//
+//===========================================================================
+
+void FMultiBlockThingsIterator::SetCollisionFilter(uint32_t flags, uint32_t flags6, bool distance)
+{
+	filtering = true;
+	filterdistance = distance && P_NumPortalGroups() <= 1;
+	filterflags = flags;
+	filterflags6 = flags6;
+}
+
 //===========================================================================
 //
 // start iterating a new group
@@ -1205,9 +1224,26 @@ FMultiBlockThingsIterator::FMultiBlockThingsIterator(FPortalGroupArray &check, d
 
 bool FMultiBlockThingsIterator::Next(FMultiBlockThingsIterator::CheckResult *item)
 {
-	AActor *thing = blockIterator.Next();
-	if (thing != NULL)
+	AActor *thing;
+	while ((thing = blockIterator.Next()) != NULL)
 	{
+		if (filtering)
+		{
+			// This must match the first checks the callers used to do,
+			// so the remaining things are handled in the same order as before.
+			if (!((thing->flags.GetValue() & filterflags) || (thing->flags6.GetValue() & filterflags6)))
+			{
+				continue;
+			}
+			if (filterdistance)
+			{
+				double blockdist = thing->radius + checkpoint.Z;
+				if (fabs(thing->X() - checkpoint.X) >= blockdist || fabs(thing->Y() - checkpoint.Y) >= blockdist)
+				{
+					continue;
+				}
+			}
+		}
 		item->thing = thing;
 		item->Position = checkpoint + Displacements.getOffset(basegroup, thing->Sector->PortalGroup);
 		item->portalflags = portalflags;
@@ -325,6 +325,10 @@ class FMultiBlockThingsIterator
 	short index;
 	FBlockThingsIterator blockIterator;
 	FBoundingBox bbox;
+	bool filtering = false;
+	bool filterdistance = false;
+	uint32_t filterflags;
+	uint32_t filterflags6;
 
 	void startIteratorForGroup(int group);
 
@@ -343,6 +347,7 @@ public:
 	FMultiBlockThingsIterator(FPortalGroupArray &check, double checkx, double checky, double checkz, double checkh, double checkradius, bool ignorerestricted, sector_t *newsec);
 	bool Next(CheckResult *item);
 	void Reset();
+	void SetCollisionFilter(uint32_t flags, uint32_t flags6, bool distance = true);
 	const FBoundingBox &Box() const
 	{
 		return bbox;
@@ -85,6 +85,7 @@
 #include "a_keys.h"
 #include "p_conversation.h"
 #include "g_game.h"
+#include "d_net.h"
 #include "teaminfo.h"
 #include "r_data/r_translate.h"
 #include "r_sky.h"
@@ -5467,6 +5468,10 @@ APlayerPawn *P_SpawnPlayer (FPlayerStart *mthing, int playernum, int flags)
 	if ((unsigned)playernum >= (unsigned)MAXPLAYERS || !playeringame[playernum])
 		return NULL;
 
+	// A dedicated host only relays ticcmds and has no body in the world.
+	if (Net_IsDedicatedHost (playernum))
+		return NULL;
+
 	// Old lerp data needs to go
 	if (playernum == consoleplayer)
 	{
@@ -5841,7 +5846,7 @@ AActor *P_SpawnMapThing (FMapThing *mthing, int position)
 			mask = 0;
 			for (int i = 0; i < MAXPLAYERS; i++)
 			{
-				if (playeringame[i])
+				if (playeringame[i] && !Net_IsDedicatedHost(i))
 				{
 					int spawnmask = players[i].GetSpawnClass();
 					if (spawnmask != 0)
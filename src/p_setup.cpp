@@ -60,6 +60,7 @@
 
 #include <math.h>
 #include <float.h>
+#include <future>
 #ifdef _MSC_VER
 #include <malloc.h>		// for alloca()
 #endif
@@ -114,6 +115,7 @@
 #include "edata.h"
 #endif
 #include "events.h"
+#include "b_bot.h"
 #include "types.h"
 
 #include "fragglescript/t_fs.h"
@@ -2704,49 +2706,32 @@ void P_LoadSideDefs2 (MapData *map, FMissingTextureTracker &missingtex)
 //
 //===========================================================================
 
-static unsigned int BlockHash (TArray<int> *block)
+static unsigned int BlockHash (const int *ar, int size)
 {
 	int hash = 0;
-	int *ar = &(*block)[0];
-	for (size_t i = 0; i < block->Size(); ++i)
+	for (int i = 0; i < size; ++i)
 	{
 		hash = hash * 12235 + ar[i];
 	}
 	return hash & 0x7fffffff;
 }
 
-static bool BlockCompare (TArray<int> *block1, TArray<int> *block2)
+static bool BlockCompare (const int *ar1, int size1, const int *ar2, int size2)
 {
-	size_t size = block1->Size();
-
-	if (size != block2->Size())
+	if (size1 != size2)
 	{
 		return false;
 	}
-	if (size == 0)
-	{
-		return true;
-	}
-	int *ar1 = &(*block1)[0];
-	int *ar2 = &(*block2)[0];
-	for (size_t i = 0; i < size; ++i)
-	{
-		if (ar1[i] != ar2[i])
-		{
-			return false;
-		}
-	}
-	return true;
+	return size1 == 0 || memcmp (ar1, ar2, size1 * sizeof(int)) == 0;
 }
 
-static void CreatePackedBlockmap (TArray<int> &BlockMap, TArray<int> *blocks, int bmapwidth, int bmapheight)
+// Block i's lines are BlockLines[BlockStart[i]] to BlockLines[BlockStart[i+1]-1].
+static void CreatePackedBlockmap (TArray<int> &BlockMap, const int *BlockStart, const int *BlockLines, int bmapwidth, int bmapheight)
 {
 	int buckets[4096];
 	int *hashes, hashblock;
-	TArray<int> *block;
 	int zero = 0;
 	int terminator = -1;
-	int *array;
 	int i, hash;
 	int hashed = 0, nothashed = 0;
 
@@ -2757,12 +2742,13 @@ static void CreatePackedBlockmap (TArray<int> &BlockMap, TArray<int> *blocks, in
 
 	for (i = 0; i < bmapwidth * bmapheight; ++i)
 	{
-		block = &blocks[i];
-		hash = BlockHash (block) % 4096;
+		const int *block = &BlockLines[BlockStart[i]];
+		int size = BlockStart[i+1] - BlockStart[i];
+		hash = BlockHash (block, size) % 4096;
 		hashblock = buckets[hash];
 		while (hashblock != -1)
 		{
-			if (BlockCompare (block, &blocks[hashblock]))
+			if (BlockCompare (block, size, &BlockLines[BlockStart[hashblock]], BlockStart[hashblock+1] - BlockStart[hashblock]))
 			{
 				break;
 			}
@@ -2779,10 +2765,10 @@ static void CreatePackedBlockmap (TArray<int> &BlockMap, TArray<int> *blocks, in
 			buckets[hash] = i;
 			BlockMap[4+i] = BlockMap.Size ();
 			BlockMap.Push (zero);
-			array = &(*block)[0];
-			for (size_t j = 0; j < block->Size(); ++j)
+			unsigned pos = BlockMap.Reserve (size);
+			if (size > 0)
 			{
-				BlockMap.Push (array[j]);
+				memcpy (&BlockMap[pos], block, size * sizeof(int));
 			}
 			BlockMap.Push (terminator);
 			nothashed++;
@@ -2797,9 +2783,133 @@ static void CreatePackedBlockmap (TArray<int> &BlockMap, TArray<int> *blocks, in
 #define BLOCKBITS 7
 #define BLOCKSIZE 128
 
+//===========================================================================
+//
+// Calls visit for every block a line touches. Used twice by
+// P_CreateBlockMap, first to count the lines in each block and then to
+// store them, so no per-block arrays need to be grown.
+//
+//===========================================================================
+
+template<class Visit>
+static void RasterizeBlockLine (int line, int minx, int miny, int bmapwidth, Visit &&visit)
+{
+	int x1 = int(level.lines[line].v1->fX());
+	int y1 = int(level.lines[line].v1->fY());
+	int x2 = int(level.lines[line].v2->fX());
+	int y2 = int(level.lines[line].v2->fY());
+	int dx = x2 - x1;
+	int dy = y2 - y1;
+	int bx = (x1 - minx) >> BLOCKBITS;
+	int by = (y1 - miny) >> BLOCKBITS;
+	int bx2 = (x2 - minx) >> BLOCKBITS;
+	int by2 = (y2 - miny) >> BLOCKBITS;
+
+	int block = bx + by * bmapwidth;
+	int endblock = bx2 + by2 * bmapwidth;
+
+	if (block == endblock)	// Single block
+	{
+		visit (block);
+	}
+	else if (by == by2)		// Horizontal line
+	{
+		if (bx > bx2)
+		{
+			swapvalues (block, endblock);
+		}
+		do
+		{
+			visit (block);
+			block += 1;
+		} while (block <= endblock);
+	}
+	else if (bx == bx2)	// Vertical line
+	{
+		if (by > by2)
+		{
+			swapvalues (block, endblock);
+		}
+		do
+		{
+			visit (block);
+			block += bmapwidth;
+		} while (block <= endblock);
+	}
+	else				// Diagonal line
+	{
+		int xchange = (dx < 0) ? -1 : 1;
+		int ychange = (dy < 0) ? -1 : 1;
+		int ymove = ychange * bmapwidth;
+		int adx = abs (dx);
+		int ady = abs (dy);
+
+		if (adx == ady)		// 45 degrees
+		{
+			int xb = (x1 - minx) & (BLOCKSIZE-1);
+			int yb = (y1 - miny) & (BLOCKSIZE-1);
+			if (dx < 0)
+			{
+				xb = BLOCKSIZE-xb;
+			}
+			if (dy < 0)
+			{
+				yb = BLOCKSIZE-yb;
+			}
+			if (xb < yb)
+				adx--;
+		}
+		if (adx >= ady)		// X-major
+		{
+			int yadd = dy < 0 ? -1 : BLOCKSIZE;
+			do
+			{
+				int stop = (Scale ((by << BLOCKBITS) + yadd - (y1 - miny), dx, dy) + (x1 - minx)) >> BLOCKBITS;
+				while (bx != stop)
+				{
+					visit (block);
+					block += xchange;
+					bx += xchange;
+				}
+				visit (block);
+				block += ymove;
+				by += ychange;
+			} while (by != by2);
+			while (block != endblock)
+			{
+				visit (block);
+				block += xchange;
+			}
+			visit (block);
+		}
+		else					// Y-major
+		{
+			int xadd = dx < 0 ? -1 : BLOCKSIZE;
+			do
+			{
+				int stop = (Scale ((bx << BLOCKBITS) + xadd - (x1 - minx), dy, dx) + (y1 - miny)) >> BLOCKBITS;
+				while (by != stop)
+				{
+					visit (block);
+					block += ymove;
+					by += ychange;
+				}
+				visit (block);
+				block += xchange;
+				bx += xchange;
+			} while (bx != bx2);
+			while (block != endblock)
+			{
+				visit (block);
+				block += ymove;
+			}
+			visit (block);
+		}
+	}
+}
+
 static void P_CreateBlockMap ()
 {
-	TArray<int> *BlockLists, *block, *endblock;
 	int adder;
 	int bmapwidth, bmapheight;
 	double dminx, dmaxx, dminy, dmaxy;
@@ -2829,140 +2939,45 @@ static void P_CreateBlockMap ()
 	bmapwidth =	 ((maxx - minx) >> BLOCKBITS) + 1;
 	bmapheight = ((maxy - miny) >> BLOCKBITS) + 1;
 
-	TArray<int> BlockMap (bmapwidth * bmapheight * 3 + 4);
+	const int numblocks = bmapwidth * bmapheight;
+	const int numlines = (int)level.lines.Size();
 
-	adder = minx;			BlockMap.Push (adder);
-	adder = miny;			BlockMap.Push (adder);
-	adder = bmapwidth;		BlockMap.Push (adder);
-	adder = bmapheight;		BlockMap.Push (adder);
-
-	BlockLists = new TArray<int>[bmapwidth * bmapheight];
-
-	for (line = 0; line < (int)level.lines.Size(); ++line)
+	// Count the lines in each block, then turn the counts into offsets.
+	int *BlockStart = new int[numblocks + 1];
+	memset (BlockStart, 0, sizeof(int) * (numblocks + 1));
+	for (line = 0; line < numlines; ++line)
+	{
+		RasterizeBlockLine (line, minx, miny, bmapwidth, [=](int block) { BlockStart[block + 1]++; });
+	}
+	for (int i = 0; i < numblocks; ++i)
 	{
-		int x1 = int(level.lines[line].v1->fX());
-		int y1 = int(level.lines[line].v1->fY());
-		int x2 = int(level.lines[line].v2->fX());
-		int y2 = int(level.lines[line].v2->fY());
-		int dx = x2 - x1;
-		int dy = y2 - y1;
-		int bx = (x1 - minx) >> BLOCKBITS;
-		int by = (y1 - miny) >> BLOCKBITS;
-		int bx2 = (x2 - minx) >> BLOCKBITS;
-		int by2 = (y2 - miny) >> BLOCKBITS;
+		BlockStart[i + 1] += BlockStart[i];
+	}
 
-		block = &BlockLists[bx + by * bmapwidth];
-		endblock = &BlockLists[bx2 + by2 * bmapwidth];
+	// Lines are stored in ascending order within each block.
+	int *BlockLines = new int[BlockStart[numblocks] + 1];
+	int *BlockFill = new int[numblocks];
+	memcpy (BlockFill, BlockStart, sizeof(int) * numblocks);
+	for (line = 0; line < numlines; ++line)
+	{
+		RasterizeBlockLine (line, minx, miny, bmapwidth, [=](int block) { BlockLines[BlockFill[block]++] = line; });
+	}
+	delete[] BlockFill;
 
-		if (block == endblock)	// Single block
-		{
-			block->Push (line);
-		}
-		else if (by == by2)		// Horizontal line
-		{
-			if (bx > bx2)
-			{
-				swapvalues (block, endblock);
-			}
-			do
-			{
-				block->Push (line);
-				block += 1;
-			} while (block <= endblock);
-		}
-		else if (bx == bx2)	// Vertical line
-		{
-			if (by > by2)
-			{
-				swapvalues (block, endblock);
-			}
-			do
-			{
-				block->Push (line);
-				block += bmapwidth;
-			} while (block <= endblock);
-		}
-		else				// Diagonal line
-		{
-			int xchange = (dx < 0) ? -1 : 1;
-			int ychange = (dy < 0) ? -1 : 1;
-			int ymove = ychange * bmapwidth;
-			int adx = abs (dx);
-			int ady = abs (dy);
+	TArray<int> BlockMap (numblocks * 3 + BlockStart[numblocks] + 4);
 
-			if (adx == ady)		// 45 degrees
-			{
-				int xb = (x1 - minx) & (BLOCKSIZE-1);
-				int yb = (y1 - miny) & (BLOCKSIZE-1);
-				if (dx < 0)
-				{
-					xb = BLOCKSIZE-xb;
-				}
-				if (dy < 0)
-				{
-					yb = BLOCKSIZE-yb;
-				}
-				if (xb < yb)
-					adx--;
-			}
-			if (adx >= ady)		// X-major
-			{
-				int yadd = dy < 0 ? -1 : BLOCKSIZE;
-				do
-				{
-					int stop = (Scale ((by << BLOCKBITS) + yadd - (y1 - miny), dx, dy) + (x1 - minx)) >> BLOCKBITS;
-					while (bx != stop)
-					{
-						block->Push (line);
-						block += xchange;
-						bx += xchange;
-					}
-					block->Push (line);
-					block += ymove;
-					by += ychange;
-				} while (by != by2);
-				while (block != endblock)
-				{
-					block->Push (line);
-					block += xchange;
-				}
-				block->Push (line);
-			}
-			else					// Y-major
-			{
-				int xadd = dx < 0 ? -1 : BLOCKSIZE;
-				do
-				{
-					int stop = (Scale ((bx << BLOCKBITS) + xadd - (x1 - minx), dy, dx) + (y1 - miny)) >> BLOCKBITS;
-					while (by != stop)
-					{
-						block->Push (line);
-						block += ymove;
-						by += ychange;
-					}
-					block->Push (line);
-					block += xchange;
-					bx += xchange;
-				} while (bx != bx2);
-				while (block != endblock)
-				{
-					block->Push (line);
-					block += ymove;
-				}
-				block->Push (line);
-			}
-		}
-	}
+	adder = minx;			BlockMap.Push (adder);
+	adder = miny;			BlockMap.Push (adder);
+	adder = bmapwidth;		BlockMap.Push (adder);
+	adder = bmapheight;		BlockMap.Push (adder);
 
-	BlockMap.Reserve (bmapwidth * bmapheight);
-	CreatePackedBlockmap (BlockMap, BlockLists, bmapwidth, bmapheight);
-	delete[] BlockLists;
+	BlockMap.Reserve (numblocks);
+	CreatePackedBlockmap (BlockMap, BlockStart, BlockLines, bmapwidth, bmapheight);
+	delete[] BlockLines;
+	delete[] BlockStart;
 
 	level.blockmap.blockmaplump = new int[BlockMap.Size()];
-	for (unsigned int ii = 0; ii < BlockMap.Size(); ++ii)
-	{
-		level.blockmap.blockmaplump[ii] = BlockMap[ii];
-	}
+	memcpy (level.blockmap.blockmaplump, &BlockMap[0], BlockMap.Size() * sizeof(int));
 }
 
 
@@ -3054,6 +3069,10 @@ bool FBlockmap::VerifyBlockMap(int count)
 //
 // P_LoadBlockMap
 //
+// Reads the map's BLOCKMAP lump. P_SetupLevel builds a new one instead
+// when P_MustCreateBlockMap says so; this only falls back to that if the
+// lump turns out to be broken.
+//
 // killough 3/1/98: substantially modified to work
 // towards removing blockmap limit (a wad limitation)
 //
@@ -3061,52 +3080,66 @@ bool FBlockmap::VerifyBlockMap(int count)
 //
 //===========================================================================
 
-void P_LoadBlockMap (MapData * map)
+static void P_FinishBlockMap ();
+
+static bool P_MustCreateBlockMap (MapData * map)
 {
 	int count = map->Size(ML_BLOCKMAP);
 
-	if (ForceNodeBuild || genblockmap ||
+	return ForceNodeBuild || genblockmap ||
 		count/2 >= 0x10000 || count == 0 ||
-		Args->CheckParm("-blockmap")
-		)
-	{
-		DPrintf (DMSG_SPAMMY, "Generating BLOCKMAP\n");
-		P_CreateBlockMap ();
-	}
-	else
-	{
-		uint8_t *data = new uint8_t[count];
-		map->Read(ML_BLOCKMAP, data);
-		const short *wadblockmaplump = (short *)data;
-		int i;
+		Args->CheckParm("-blockmap");
+}
 
-		count/=2;
-		level.blockmap.blockmaplump = new int[count];
+void P_LoadBlockMap (MapData * map)
+{
+	int count = map->Size(ML_BLOCKMAP);
 
-		// killough 3/1/98: Expand wad blockmap into larger internal one,
-		// by treating all offsets except -1 as unsigned and zero-extending
-		// them. This potentially doubles the size of blockmaps allowed,
-		// because Doom originally considered the offsets as always signed.
+	uint8_t *data = new uint8_t[count];
+	map->Read(ML_BLOCKMAP, data);
+	const short *wadblockmaplump = (short *)data;
+	int i;
 
-		level.blockmap.blockmaplump[0] = LittleShort(wadblockmaplump[0]);
-		level.blockmap.blockmaplump[1] = LittleShort(wadblockmaplump[1]);
-		level.blockmap.blockmaplump[2] = (uint32_t)(LittleShort(wadblockmaplump[2])) & 0xffff;
-		level.blockmap.blockmaplump[3] = (uint32_t)(LittleShort(wadblockmaplump[3])) & 0xffff;
+	count/=2;
+	level.blockmap.blockmaplump = new int[count];
 
-		for (i = 4; i < count; i++)
-		{
-			short t = LittleShort(wadblockmaplump[i]);          // killough 3/1/98
-			level.blockmap.blockmaplump[i] = t == -1 ? (uint32_t)0xffffffff : (uint32_t) t & 0xffff;
-		}
-		delete[] data;
+	// killough 3/1/98: Expand wad blockmap into larger internal one,
+	// by treating all offsets except -1 as unsigned and zero-extending
+	// them. This potentially doubles the size of blockmaps allowed,
+	// because Doom originally considered the offsets as always signed.
 
-		if (!level.blockmap.VerifyBlockMap(count))
-		{
-			DPrintf (DMSG_SPAMMY, "Generating BLOCKMAP\n");
-			P_CreateBlockMap();
-		}
+	level.blockmap.blockmaplump[0] = LittleShort(wadblockmaplump[0]);
+	level.blockmap.blockmaplump[1] = LittleShort(wadblockmaplump[1]);
+	level.blockmap.blockmaplump[2] = (uint32_t)(LittleShort(wadblockmaplump[2])) & 0xffff;
+	level.blockmap.blockmaplump[3] = (uint32_t)(LittleShort(wadblockmaplump[3])) & 0xffff;
 
+	for (i = 4; i < count; i++)
+	{
+		short t = LittleShort(wadblockmaplump[i]);          // killough 3/1/98
+		level.blockmap.blockmaplump[i] = t == -1 ? (uint32_t)0xffffffff : (uint32_t) t & 0xffff;
 	}
+	delete[] data;
+
+	if (!level.blockmap.VerifyBlockMap(count))
+	{
+		DPrintf (DMSG_SPAMMY, "Generating BLOCKMAP\n");
+		P_CreateBlockMap();
+	}
+	P_FinishBlockMap ();
+}
+
+//===========================================================================
+//
+// P_FinishBlockMap
+//
+// Sets up the blockmap header fields and thing chains once
+// blockmaplump is complete.
+//
+//===========================================================================
+
+static void P_FinishBlockMap ()
+{
+	int count;
 
 	level.blockmap.bmaporgx = level.blockmap.blockmaplump[0];
 	level.blockmap.bmaporgy = level.blockmap.blockmaplump[1];
@@ -3350,6 +3383,171 @@ void P_LoadReject (MapData * map, bool junk)
 	}
 }
 
+//===========================================================================
+//
+// P_AllSectorsClosed
+// Every vertex of a closed sector is used by an even number of the
+// sector's own line sides.
+//
+//===========================================================================
+
+static bool P_AllSectorsClosed ()
+{
+	TArray<int> count;
+	count.Resize(level.vertexes.Size());
+	for (auto &c : count)
+	{
+		c = 0;
+	}
+
+	bool closed = true;
+	for (auto &sec : level.sectors)
+	{
+		for (auto line : sec.Lines)
+		{
+			int sides = (line->frontsector == &sec) + (line->backsector == &sec);
+			count[line->v1->Index()] += sides;
+			count[line->v2->Index()] += sides;
+		}
+		for (auto line : sec.Lines)
+		{
+			if ((count[line->v1->Index()] | count[line->v2->Index()]) & 1)
+			{
+				closed = false;
+			}
+		}
+		for (auto line : sec.Lines)
+		{
+			count[line->v1->Index()] = count[line->v2->Index()] = 0;
+		}
+		if (!closed)
+		{
+			DPrintf(DMSG_NOTIFY, "Sector %d is not closed, not building sight groups\n", sec.Index());
+			return false;
+		}
+	}
+	return true;
+}
+
+//===========================================================================
+//
+// P_BuildSightGroups
+// Most maps without a REJECT lump still consist of several areas that
+// are not connected by any two-sided line, e.g. monster closets that
+// are only reached by teleporting. Sectors in different areas can never
+// see each other, which lets P_CheckSight reject them without tracing.
+// Door and lift heights are ignored so this stays valid when they move.
+// Sectors that only touch at a vertex are joined too, because a trace
+// passing exactly through that vertex is not blocked.
+//
+// Every subsector is joined with the sectors on its segs as well, which
+// covers self-referencing sectors whose lines only face themselves.
+// A sector that isn't closed can leak sight into an unconnected one, so
+// maps with such sectors don't get any groups. Older demos were recorded
+// without this, so it is left off when playing them back.
+//
+//===========================================================================
+
+static void P_BuildSightGroups ()
+{
+	level.sightgroups.Clear();
+
+	// Linked portals let sight pass between otherwise unconnected areas.
+	if (level.rejectmatrix.Size() > 0 || P_NumPortalGroups() > 1)
+	{
+		return;
+	}
+	if (demoplayback && demover < 0x222)
+	{
+		return;
+	}
+	if (!P_AllSectorsClosed())
+	{
+		return;
+	}
+
+	unsigned numsectors = level.sectors.Size();
+	TArray<int> parent;
+	parent.Resize(numsectors);
+	for (unsigned i = 0; i < numsectors; i++)
+	{
+		parent[i] = i;
+	}
+
+	auto find = [&](int sec) -> int
+	{
+		while (parent[sec] != sec)
+		{
+			parent[sec] = parent[parent[sec]];
+			sec = parent[sec];
+		}
+		return sec;
+	};
+	auto join = [&](sector_t *a, sector_t *b)
+	{
+		if (a == NULL || b == NULL) return;
+		int ra = find(a->Index());
+		int rb = find(b->Index());
+		if (ra < rb) parent[rb] = ra;
+		else if (rb < ra) parent[ra] = rb;
+	};
+
+	TArray<sector_t *> vertexsector;
+	vertexsector.Resize(level.vertexes.Size());
+	for (auto &sec : vertexsector)
+	{
+		sec = NULL;
+	}
+	auto touch = [&](vertex_t *v, sector_t *sec)
+	{
+		if (sec == NULL) return;
+		sector_t *&first = vertexsector[v->Index()];
+		if (first == NULL) first = sec;
+		else join(first, sec);
+	};
+
+	for (auto &line : level.lines)
+	{
+		join(line.frontsector, line.backsector);
+		if (line.isLinePortal())
+		{
+			line_t *dest = line.getPortalDestination();
+			if (dest != NULL) join(line.frontsector, dest->frontsector);
+		}
+		touch(line.v1, line.frontsector);
+		touch(line.v1, line.backsector);
+		touch(line.v2, line.frontsector);
+		touch(line.v2, line.backsector);
+	}
+	// The lines alone don't tell which sector surrounds a self-referencing
+	// sector, so also join every subsector with what its segs face.
+	for (auto &sub : level.subsectors)
+	{
+		for (uint32_t i = 0; i < sub.numlines; i++)
+		{
+			seg_t *seg = &sub.firstline[i];
+			join(sub.sector, seg->frontsector);
+			join(sub.sector, seg->backsector);
+			if (seg->PartnerSeg != NULL && seg->PartnerSeg->Subsector != NULL)
+			{
+				join(sub.sector, seg->PartnerSeg->Subsector->sector);
+			}
+			touch(seg->v1, sub.sector);
+		}
+	}
+
+	bool split = false;
+	for (unsigned i = 0; i < numsectors; i++)
+	{
+		parent[i] = find(i);
+		if (parent[i] != 0) split = true;
+	}
+	if (split)
+	{
+		level.sightgroups = std::move(parent);
+	}
+}
+
 //===========================================================================
 //
 //
@@ -3515,6 +3713,7 @@ void P_FreeLevelData ()
 	interpolator.ClearInterpolations();	// [RH] Nothing to interpolate on a fresh level.
 	Renderer->CleanLevelData();
 	FPolyObj::ClearAllSubsectorLinks(); // can't be done as part of the polyobj deletion process.
+	bglobal.Nav.Clear();
 	SN_StopAllSequences ();
 	DThinker::DestroyAllThinkers ();
 	P_ClearPortals();
@@ -3546,6 +3745,7 @@ void P_FreeLevelData ()
 	level.subsectors.Clear();
 	level.gamesubsectors.Reset();
 	level.rejectmatrix.Clear();
+	level.sightgroups.Clear();
 	level.Zones.Clear();
 	level.blockmap.Clear();
 
@@ -3930,6 +4130,7 @@ void P_SetupLevel (const char *lumpname, int position)
 	}
 	else reloop = true;
 
+	times[18].Clock();
 	unsigned int startTime=0, endTime=0;
 
 	bool BuildGLNodes;
@@ -3994,12 +4195,24 @@ void P_SetupLevel (const char *lumpname, int position)
 	{
 		hasglnodes = P_CheckForGLNodes();
 	}
+	times[18].Unclock();
 
 	// set the head node for gameplay purposes. If the separate gamenodes array is not empty, use that, otherwise use the render nodes.
 	level.headgamenode = level.gamenodes.Size() > 0 ? &level.gamenodes[level.gamenodes.Size() - 1] : level.nodes.Size()? &level.nodes[level.nodes.Size() - 1] : nullptr;
 
+	// Generating a blockmap only needs the line positions, so it is done
+	// while the reject is loaded and the lines are grouped into sectors.
+	std::future<void> blockmapjob;
 	times[10].Clock();
-	P_LoadBlockMap (map);
+	if (P_MustCreateBlockMap (map))
+	{
+		DPrintf (DMSG_SPAMMY, "Generating BLOCKMAP\n");
+		blockmapjob = std::async(std::launch::async, P_CreateBlockMap);
+	}
+	else
+	{
+		P_LoadBlockMap (map);
+	}
 	times[10].Unclock();
 
 	times[11].Clock();
@@ -4010,6 +4223,14 @@ void P_SetupLevel (const char *lumpname, int position)
 	P_GroupLines (buildmap);
 	times[12].Unclock();
 
+	if (blockmapjob.valid())
+	{
+		times[10].Clock();
+		blockmapjob.get();
+		P_FinishBlockMap ();
+		times[10].Unclock();
+	}
+
 	times[13].Clock();
 	P_FloodZones ();
 	times[13].Unclock();
@@ -4087,6 +4308,7 @@ void P_SetupLevel (const char *lumpname, int position)
 	if (reloop) P_LoopSidedefs (false);
 	PO_Init ();				// Initialize the polyobjs
 	P_FinalizePortals();	// finalize line portals after polyobjects have been initialized. This info is needed for properly flagging them.
+	P_BuildSightGroups();
 	times[16].Unclock();
 
 	assert(sidetemp != NULL);
@@ -4154,6 +4376,7 @@ void P_SetupLevel (const char *lumpname, int position)
 		P_PrecacheLevel ();
 		S_PrecacheLevel ();
 	}
+	Wads.TrimCaches ();
 	times[17].Unclock();
 
 	if (deathmatch)
@@ -4167,7 +4390,7 @@ void P_SetupLevel (const char *lumpname, int position)
 	if (showloadtimes)
 	{
 		Printf ("---Total load times---\n");
-		for (i = 0; i < 18; ++i)
+		for (i = 0; i < 19; ++i)
 		{
 			static const char *timenames[] =
 			{
@@ -4188,7 +4411,8 @@ void P_SetupLevel (const char *lumpname, int position)
 				"load things",
 				"translate teleports",
 				"init polys",
-				"precache"
+				"precache",
+				"build nodes"
 			};
 			Printf ("Time%3d:%9.4f ms (%s)\n", i, times[i].TimeMS(), timenames[i]);
 		}
@@ -879,6 +879,15 @@ sightcounts[0]++;
 		}
 	}
 
+	// Checked after the roll above so that it doesn't change RNG usage.
+	if (level.sightgroups.Size() > 0 &&
+		level.sightgroups[s1->Index()] != level.sightgroups[s2->Index()])
+	{
+sightcounts[0]++;
+		res = false;			// nothing connects the two areas
+		goto done;
+	}
+
 	// killough 4/19/98: make fake floors and ceilings block monster view
 
 	if (!(flags & SF_IGNOREWATERBOUNDARY))
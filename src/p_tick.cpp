@@ -40,6 +40,7 @@
 #include "p_spec.h"
 #include "g_levellocals.h"
 #include "events.h"
+#include "d_net.h"
 
 extern gamestate_t wipegamestate;
 
@@ -125,13 +126,14 @@ void P_Ticker (void)
 	P_ThinkParticles();	// [RH] make the particles think
 
 	for (i = 0; i<MAXPLAYERS; i++)
-		if (playeringame[i] &&
+		if (playeringame[i] && !Net_IsDedicatedHost(i) &&
 			/*Added by MC: Freeze mode.*/!(bglobal.freeze && players[i].Bot != NULL))
 			P_PlayerThink (&players[i]);
 
 	// [ZZ] call the WorldTick hook
 	E_WorldTick();
-	StatusBar->CallTick ();		// [RH] moved this here
+	if (!net_dedicated)
+		StatusBar->CallTick ();		// [RH] moved this here
 	level.Tick ();			// [RH] let the level tick
 	DThinker::RunThinkers ();
 
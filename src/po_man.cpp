@@ -161,6 +161,7 @@ polyspawns_t *polyspawns; // [RH] Let P_SpawnMapThings() find our thingies for u
 
 static TArray<int32_t> KnownPolySides;
 static FPolyNode *FreePolyNodes;
+static TArray<FBoundingBox> BlockingCandidates;	// bodies of actors near the polyobject being moved
 
 // CODE --------------------------------------------------------------------
 
@@ -948,12 +949,19 @@ bool FPolyObj::MovePolyobj (const DVector2 &pos, bool force)
 	if (!force)
 	{
 		bool blocked = false;
+		bool filter = GatherBlockingCandidates();
 
 		for(unsigned i=0;i < Sidedefs.Size(); i++)
 		{
+			if (filter && !SideTouchesCandidate(Sidedefs[i]))
+			{
+				continue;
+			}
 			if (CheckMobjBlocking(Sidedefs[i]))
 			{
+				// Thrusting may have moved, killed or spawned actors.
 				blocked = true;
+				filter = false;
 			}
 		}
 		if (blocked)
@@ -1040,11 +1048,18 @@ bool FPolyObj::RotatePolyobj (DAngle angle, bool fromsave)
 	// If we are loading a savegame we do not really want to damage actors and be blocked by them. This can also cause crashes when trying to damage incompletely deserialized player pawns.
 	if (!fromsave)
 	{
+		bool filter = GatherBlockingCandidates();
+
 		for (unsigned i = 0; i < Sidedefs.Size(); i++)
 		{
+			if (filter && !SideTouchesCandidate(Sidedefs[i]))
+			{
+				continue;
+			}
 			if (CheckMobjBlocking(Sidedefs[i]))
 			{
 				blocked = true;
+				filter = false;
 			}
 		}
 		if (blocked)
@@ -1100,6 +1115,75 @@ void FPolyObj::UnLinkPolyobj ()
 	}
 }
 
+//==========================================================================
+//
+// GatherBlockingCandidates
+//
+// Collects the bodies of all actors CheckMobjBlocking could act upon for
+// the polyobject's current (already moved) vertices. Sides that touch
+// none of them can skip the per-block actor walk entirely, which is the
+// common case for big rotating polyobjects with nobody nearby.
+// Returns false if the filter cannot be used for this polyobject.
+//
+//==========================================================================
+
+bool FPolyObj::GatherBlockingCandidates()
+{
+	BlockingCandidates.Clear();
+
+	// Portal-relative positions and P_TryMove on portal lines are beyond
+	// what a plain bounding box filter can predict.
+	if (bHasPortals || P_NumPortalGroups() > 1)
+	{
+		return false;
+	}
+
+	FBoundingBox box;
+	box.ClearBox();
+	for (unsigned i = 0; i < Vertices.Size(); i++)
+	{
+		box.AddToBox(Vertices[i]->fPos());
+	}
+
+	FBlockThingsIterator it(box);
+	AActor *mobj;
+	while ((mobj = it.Next()))
+	{
+		if ((mobj->flags&MF_SOLID) && !(mobj->flags&MF_NOCLIP))
+		{
+			FBoundingBox body(mobj->X(), mobj->Y(), mobj->radius);
+			if (body.Left() <= box.Right() && body.Right() >= box.Left() &&
+				body.Bottom() <= box.Top() && body.Top() >= box.Bottom())
+			{
+				BlockingCandidates.Push(body);
+			}
+		}
+	}
+	return true;
+}
+
+//==========================================================================
+//
+// SideTouchesCandidate
+//
+// Same range check CheckMobjBlocking uses to reject actors, but against
+// the gathered candidates instead of every actor in the side's blocks.
+//
+//==========================================================================
+
+bool FPolyObj::SideTouchesCandidate(side_t *sd) const
+{
+	const line_t *ld = sd->linedef;
+	for (unsigned i = 0; i < BlockingCandidates.Size(); i++)
+	{
+		if (BlockingCandidates[i].inRange(ld))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 //==========================================================================
 //
 // CheckMobjBlocking
@@ -113,6 +113,8 @@ private:
 	void UpdateBBox ();
 	void DoMovePolyobj (const DVector2 &pos);
 	void UnLinkPolyobj ();
+	bool GatherBlockingCandidates ();
+	bool SideTouchesCandidate (side_t *sd) const;
 	bool CheckMobjBlocking (side_t *sd);
 
 };
@@ -107,14 +107,27 @@ struct CZDFileInStream
 	}
 };
 
+// Lumps are looked up in name order, not in the order they are stored in,
+// so with several solid blocks the same block would be decoded over and
+// over if only the last one was kept around. Once a level is loaded, only
+// the last one is kept again (see TrimCaches).
+#define BLOCK_CACHE_SIZE (64 << 20)
+
 struct C7zArchive
 {
+	struct FCachedBlock
+	{
+		UInt32 Index;
+		Byte *Data;
+		size_t Size;
+		unsigned LastUse;
+	};
+
 	CSzArEx DB;
 	CZDFileInStream ArchiveStream;
 	CLookToRead LookStream;
-	UInt32 BlockIndex;
-	Byte *OutBuffer;
-	size_t OutBufferSize;
+	TArray<FCachedBlock> Blocks;
+	unsigned UseCount;
 
 	C7zArchive(FileReader *file) : ArchiveStream(file)
 	{
@@ -127,16 +140,14 @@ struct C7zArchive
 		LookStream.realStream = &ArchiveStream.s;
 		LookToRead_Init(&LookStream);
 		SzArEx_Init(&DB);
-		BlockIndex = 0xFFFFFFFF;
-		OutBuffer = NULL;
-		OutBufferSize = 0;
+		UseCount = 0;
 	}
 
 	~C7zArchive()
 	{
-		if (OutBuffer != NULL)
+		for (auto &block : Blocks)
 		{
-			IAlloc_Free(&g_Alloc, OutBuffer);
+			IAlloc_Free(&g_Alloc, block.Data);
 		}
 		SzArEx_Free(&DB, &g_Alloc);
 	}
@@ -148,17 +159,63 @@ struct C7zArchive
 
 	SRes Extract(UInt32 file_index, char *buffer)
 	{
+		UInt32 folder = DB.FileToFolder[file_index];
+		if (folder == (UInt32)-1)
+		{ // empty file
+			return SZ_OK;
+		}
+
+		unsigned i;
+		for (i = 0; i < Blocks.Size(); i++)
+		{
+			if (Blocks[i].Index == folder) break;
+		}
+		if (i == Blocks.Size())
+		{
+			Blocks.Push({ 0xFFFFFFFF, NULL, 0, 0 });
+		}
+
+		// The decoder only decodes the block if it is not the one passed in.
+		FCachedBlock *block = &Blocks[i];
 		size_t offset, out_size_processed;
 		SRes res = SzArEx_Extract(&DB, &LookStream.s, file_index,
-			&BlockIndex, &OutBuffer, &OutBufferSize,
+			&block->Index, &block->Data, &block->Size,
 			&offset, &out_size_processed,
 			&g_Alloc, &g_Alloc);
+		block->LastUse = ++UseCount;
 		if (res == SZ_OK)
 		{
-			memcpy(buffer, OutBuffer + offset, out_size_processed);
+			memcpy(buffer, block->Data + offset, out_size_processed);
+		}
+		else
+		{
+			IAlloc_Free(&g_Alloc, block->Data);
+			Blocks.Delete(i);
 		}
+		TrimCache(BLOCK_CACHE_SIZE);
 		return res;
 	}
+
+	void TrimCache(size_t limit)
+	{
+		size_t total = 0;
+		for (auto &block : Blocks)
+		{
+			total += block.Size;
+		}
+		// The most recently used block is always kept.
+		while (total > limit && Blocks.Size() > 1)
+		{
+			unsigned oldest = 0;
+			for (unsigned i = 1; i < Blocks.Size(); i++)
+			{
+				if (Blocks[i].LastUse < Blocks[oldest].LastUse) oldest = i;
+			}
+			total -= Blocks[oldest].Size;
+			IAlloc_Free(&g_Alloc, Blocks[oldest].Data);
+			Blocks.Delete(oldest);
+		}
+	}
 };
 //==========================================================================
 //
@@ -193,6 +250,7 @@ public:
 	bool Open(bool quiet);
 	virtual ~F7ZFile();
 	virtual FResourceLump *GetLump(int no) { return ((unsigned)no < NumLumps)? &Lumps[no] : NULL; }
+	virtual void TrimCaches() { if (Archive != NULL) Archive->TrimCache(0); }
 };
 
 
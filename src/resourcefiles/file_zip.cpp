@@ -49,9 +49,12 @@
 //
 // Decompression subroutine
 //
+// With quiet set nothing is printed and no exception gets out, so it can
+// run on a worker thread. The caller has to report the failure itself.
+//
 //==========================================================================
 
-static bool UncompressZipLump(char *Cache, FileReader *Reader, int Method, int LumpSize, int CompressedSize, int GPFlags)
+static bool UncompressZipLump(char *Cache, FileReader *Reader, int Method, int LumpSize, int CompressedSize, int GPFlags, bool quiet = false)
 {
 	try
 	{
@@ -104,16 +107,21 @@ static bool UncompressZipLump(char *Cache, FileReader *Reader, int Method, int L
 	}
 	catch (CRecoverableError &err)
 	{
-		Printf("%s\n", err.GetMessage());
+		if (!quiet) Printf("%s\n", err.GetMessage());
+		return false;
+	}
+	catch (...)
+	{
+		if (!quiet) throw;
 		return false;
 	}
 	return true;
 }
 
-bool FCompressedBuffer::Decompress(char *destbuffer)
+bool FCompressedBuffer::Decompress(char *destbuffer, bool quiet)
 {
 	MemoryReader mr(mBuffer, mCompressedSize);
-	return UncompressZipLump(destbuffer, &mr, mMethod, mSize, mCompressedSize, mZipFlags);
+	return UncompressZipLump(destbuffer, &mr, mMethod, mSize, mCompressedSize, mZipFlags, quiet);
 }
 
 //-----------------------------------------------------------------------
@@ -441,6 +449,17 @@ FileReader *FZipLump::GetReader()
 	else return NULL;	
 }
 
+//==========================================================================
+//
+//
+//
+//==========================================================================
+
+bool FZipLump::IsCompressed()
+{
+	return Method != METHOD_STORED;
+}
+
 //==========================================================================
 //
 // Fills the lump cache and performs decompression
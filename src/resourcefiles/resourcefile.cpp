@@ -81,6 +81,11 @@ FResourceLump::~FResourceLump()
 		delete [] Cache;
 		Cache = NULL;
 	}
+	if (Prefetched != NULL)
+	{
+		delete [] Prefetched;
+		Prefetched = NULL;
+	}
 	Owner = NULL;
 }
 
@@ -244,6 +249,12 @@ void *FResourceLump::CacheLump()
 	{
 		if (RefCount > 0) RefCount++;
 	}
+	else if (Prefetched != NULL)
+	{
+		Cache = Prefetched;
+		Prefetched = NULL;
+		RefCount = 1;
+	}
 	else if (LumpSize > 0)
 	{
 		FillCache();
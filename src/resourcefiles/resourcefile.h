@@ -18,7 +18,7 @@ struct FCompressedBuffer
 	unsigned mCRC32;
 	char *mBuffer;
 
-	bool Decompress(char *destbuffer);
+	bool Decompress(char *destbuffer, bool quiet = false);	// quiet: no messages, safe on worker threads
 	void Clean()
 	{
 		mSize = mCompressedSize = 0;
@@ -46,6 +46,7 @@ struct FResourceLump
 	uint8_t			Flags;
 	int8_t			RefCount;
 	char *			Cache;
+	char *			Prefetched;		// decompressed ahead of time, becomes the cache on first use
 	FResourceFile *	Owner;
 	FTexture *		LinkedTexture;
 	int				Namespace;
@@ -53,6 +54,7 @@ struct FResourceLump
 	FResourceLump()
 	{
 		Cache = NULL;
+		Prefetched = NULL;
 		Owner = NULL;
 		Flags = 0;
 		RefCount = 0;
@@ -66,6 +68,7 @@ struct FResourceLump
 	virtual FileReader *NewReader();
 	virtual int GetFileOffset() { return -1; }
 	virtual int GetIndexNum() const { return 0; }
+	virtual bool IsCompressed() { return false; }
 	void LumpNameSetup(FString iname);
 	void CheckEmbedded();
 	virtual FCompressedBuffer GetRawData();
@@ -111,6 +114,7 @@ public:
 	virtual void FindStrifeTeaserVoices ();
 	virtual bool Open(bool quiet) = 0;
 	virtual FResourceLump *GetLump(int no) = 0;
+	virtual void TrimCaches() {}	// Frees data kept around to speed up loading
 	FResourceLump *FindLump(const char *name);
 };
 
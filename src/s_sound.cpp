@@ -535,6 +535,22 @@ void S_PrecacheLevel ()
 			chan->SoundID.MarkUsed();
 		}
 
+		// Inflate the sounds that still need loading all at once.
+		// Without a real sound device nothing gets loaded, so don't bother.
+		TArray<int> lumps;
+		if (!GSnd->IsNull())
+		{
+			for (i = 1; i < S_sfx.Size(); ++i)
+			{
+				if (S_sfx[i].bUsed && !S_sfx[i].bPlayerReserve && S_sfx[i].link == sfxinfo_t::NO_LINK &&
+					!S_sfx[i].data.isValid() && S_sfx[i].lumpnum >= 0)
+				{
+					lumps.Push(S_sfx[i].lumpnum);
+				}
+			}
+			Wads.PrefetchLumps(lumps);
+		}
+
 		for (i = 1; i < S_sfx.Size(); ++i)
 		{
 			if (S_sfx[i].bUsed)
@@ -542,6 +558,9 @@ void S_PrecacheLevel ()
 				S_CacheSound (&S_sfx[i]);
 			}
 		}
+		// Sounds that got resolved to an already loaded sound with the same
+		// lump never cache it, so throw away anything left over.
+		Wads.DropPrefetched(lumps);
 		for (i = 1; i < S_sfx.Size(); ++i)
 		{
 			if (!S_sfx[i].bUsed && S_sfx[i].link == sfxinfo_t::NO_LINK)
@@ -601,6 +601,75 @@ bool FScanner::CheckString (const char *name)
 	return false;
 }
 
+//==========================================================================
+//
+// ParseDecimalInt
+// ParseDecimalFloat
+//
+// Fast paths for the plain decimal constants that make up most of a
+// UDMF map. They only accept values they can convert exactly, so the
+// results are the same as from strtoll and strtod. Anything else is
+// left to the C library.
+//
+//==========================================================================
+
+static bool ParseDecimalInt (const char *str, int &result)
+{
+	int value = 0;
+	int digits = 0;
+
+	if (str[0] == '0' && str[1] != 0)
+	{
+		return false;	// octal
+	}
+	for (; *str >= '0' && *str <= '9'; ++str)
+	{
+		if (++digits > 9) return false;
+		value = value * 10 + (*str - '0');
+	}
+	if (*str != 0 || digits == 0)
+	{
+		return false;
+	}
+	result = value;
+	return true;
+}
+
+static bool ParseDecimalFloat (const char *str, double &result)
+{
+	// Integers below 2^53 and powers of ten up to 1e22 are exact doubles,
+	// so a single division gives the correctly rounded value.
+	static const double powers[] =
+	{
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+	int64_t mantissa = 0;
+	int digits = 0;
+	int fraction = -1;
+
+	for (;; ++str)
+	{
+		if (*str >= '0' && *str <= '9')
+		{
+			if (++digits > 15) return false;
+			mantissa = mantissa * 10 + (*str - '0');
+			if (fraction >= 0) fraction++;
+		}
+		else if (*str == '.' && fraction < 0)
+		{
+			fraction = 0;
+		}
+		else break;
+	}
+	if (*str != 0 || digits == 0)
+	{
+		return false;	// exponent or suffix
+	}
+	result = fraction > 0 ? double(mantissa) / powers[fraction] : double(mantissa);
+	return true;
+}
+
 //==========================================================================
 //
 // FScanner :: GetToken
@@ -630,14 +699,20 @@ bool FScanner::GetToken ()
 			}
 			else
 			{
-				Number = (int)strtoll(String, &stopper, 0);
+				if (!ParseDecimalInt(String, Number))
+				{
+					Number = (int)strtoll(String, &stopper, 0);
+				}
 				Float = Number;
 			}
 		}
 		else if (TokenType == TK_FloatConst)
 		{
 			char *stopper;
-			Float = strtod(String, &stopper);
+			if (!ParseDecimalFloat(String, Float))
+			{
+				Float = strtod(String, &stopper);
+			}
 		}
 		else if (TokenType == TK_StringConst)
 		{
@@ -132,6 +132,19 @@ struct VMExec_Unchecked
 {
 #include "vmexec.h"
 };
+
+// The profiled engine is the unchecked one, with a sample taken every few
+// instructions. It is only selected while vmprofile is running.
+#undef NEXTOP
+#if COMPGOTO
+#define NEXTOP	do { pc++; if (--VMProfileCountdown <= 0) VMProfileSample(f, pc); unsigned op = pc->op; a = pc->a; goto *ops[op]; } while(0)
+#else
+#define NEXTOP	pc++; if (--VMProfileCountdown <= 0) VMProfileSample(f, pc); break
+#endif
+struct VMExec_Profiled
+{
+#include "vmexec.h"
+};
 #if !WAS_NDEBUG
 #undef NDEBUG
 #endif
@@ -178,6 +191,9 @@ void VMSelectEngine(EVMEngine engine)
 	case VMEngine_Checked:
 		VMExec = VMExec_Checked::Exec;
 		break;
+	case VMEngine_Profiled:
+		VMExec = VMExec_Profiled::Exec;
+		break;
 	}
 }
 
@@ -637,3 +637,206 @@ CCMD(vmengine)
 	Printf("Usage: vmengine <default|checked|unchecked>\n");
 }
 
+
+//-----------------------------------------------------------------------------
+//
+// Sampling profiler
+//
+// While running, the profiled VM engine calls VMProfileSample every
+// VMProfileInterval instructions. Each sample is charged to the function and
+// line that was about to execute (exclusive) and to every function on the
+// frame stack (inclusive). The stacks are also kept in the folded format
+// that flame graph tools read. Everything is keyed by name so that the data
+// survives functions getting freed on a restart.
+//
+//-----------------------------------------------------------------------------
+
+struct VMProfileEntry
+{
+	unsigned Exclusive = 0;
+	unsigned Inclusive = 0;
+};
+
+int VMProfileCountdown;
+static int VMProfileInterval = 1000;
+static unsigned VMProfileSamples;
+static bool VMProfiling;
+static int (*VMProfileSavedExec)(VMFrameStack *stack, const VMOP *pc, VMReturn *ret, int numret);
+static TMap<FString, VMProfileEntry> VMProfileFunctions;
+static TMap<FString, unsigned> VMProfileLines;
+static TMap<FString, unsigned> VMProfileStacks;
+
+void VMProfileSample(VMFrame *f, const VMOP *pc)
+{
+	static TArray<VMFrame *> frames;
+	static TArray<VMFunction *> seen;
+
+	VMProfileCountdown = VMProfileInterval;
+	VMProfileSamples++;
+
+	frames.Clear();
+	seen.Clear();
+	for (VMFrame *frame = f; frame != nullptr; frame = frame->ParentFrame)
+	{
+		if (frame->Func != nullptr)
+		{
+			frames.Push(frame);
+		}
+	}
+	if (frames.Size() == 0)
+	{
+		return;
+	}
+
+	FString stack;
+	for (int i = frames.Size() - 1; i >= 0; i--)
+	{
+		VMFunction *func = frames[i]->Func;
+		if (i != (int)frames.Size() - 1)
+		{
+			stack += ';';
+		}
+		stack += func->PrintableName;
+
+		// Recursive calls only count once.
+		if (seen.Find(func) == seen.Size())
+		{
+			seen.Push(func);
+			VMProfileFunctions[func->PrintableName].Inclusive++;
+		}
+	}
+	VMProfileStacks[stack]++;
+
+	VMFunction *func = f->Func;
+	VMProfileFunctions[func->PrintableName].Exclusive++;
+	if (!(func->VarFlags & VARF_Native))
+	{
+		auto sfunc = static_cast<VMScriptFunction *>(func);
+		VMProfileLines[FStringf("%s:%d", sfunc->SourceFileName.GetChars(), sfunc->PCToLine(pc))]++;
+	}
+}
+
+struct VMProfileItem
+{
+	const FString *Name;
+	unsigned Count;
+	unsigned Inclusive;
+};
+
+static int VMProfileCompare(const void *a, const void *b)
+{
+	unsigned ca = ((const VMProfileItem *)a)->Count;
+	unsigned cb = ((const VMProfileItem *)b)->Count;
+	return ca < cb ? 1 : ca > cb ? -1 : 0;
+}
+
+static void VMProfileShow(unsigned limit)
+{
+	TArray<VMProfileItem> items;
+	double scale = VMProfileSamples > 0 ? 100. / VMProfileSamples : 0;
+
+	Printf("%u samples, one every %d instructions\n", VMProfileSamples, VMProfileInterval);
+
+	TMap<FString, VMProfileEntry>::Iterator fit(VMProfileFunctions);
+	TMap<FString, VMProfileEntry>::Pair *fpair;
+	while (fit.NextPair(fpair))
+	{
+		items.Push({ &fpair->Key, fpair->Value.Exclusive, fpair->Value.Inclusive });
+	}
+	if (items.Size() > 0)
+	{
+		qsort(&items[0], items.Size(), sizeof(VMProfileItem), VMProfileCompare);
+	}
+	Printf(TEXTCOLOR_YELLOW "  Excl%%   Incl%%  Function\n");
+	for (unsigned i = 0; i < items.Size() && i < limit; i++)
+	{
+		Printf("%6.2f  %6.2f  %s\n", items[i].Count * scale, items[i].Inclusive * scale, items[i].Name->GetChars());
+	}
+
+	items.Clear();
+	TMap<FString, unsigned>::Iterator lit(VMProfileLines);
+	TMap<FString, unsigned>::Pair *lpair;
+	while (lit.NextPair(lpair))
+	{
+		items.Push({ &lpair->Key, lpair->Value, 0 });
+	}
+	if (items.Size() > 0)
+	{
+		qsort(&items[0], items.Size(), sizeof(VMProfileItem), VMProfileCompare);
+	}
+	Printf(TEXTCOLOR_YELLOW "  Excl%%  Line\n");
+	for (unsigned i = 0; i < items.Size() && i < limit; i++)
+	{
+		Printf("%6.2f  %s\n", items[i].Count * scale, items[i].Name->GetChars());
+	}
+}
+
+static bool VMProfileDump(const char *filename)
+{
+	FILE *f = fopen(filename, "w");
+	if (f == nullptr)
+	{
+		Printf("Could not open %s for writing\n", filename);
+		return false;
+	}
+	TMap<FString, unsigned>::Iterator it(VMProfileStacks);
+	TMap<FString, unsigned>::Pair *pair;
+	while (it.NextPair(pair))
+	{
+		fprintf(f, "%s %u\n", pair->Key.GetChars(), pair->Value);
+	}
+	fclose(f);
+	return true;
+}
+
+CCMD(vmprofile)
+{
+	if (argv.argc() >= 2)
+	{
+		if (stricmp(argv[1], "start") == 0)
+		{
+			if (argv.argc() >= 3)
+			{
+				VMProfileInterval = MAX(1, (int)strtol(argv[2], nullptr, 0));
+			}
+			VMProfileFunctions.Clear();
+			VMProfileLines.Clear();
+			VMProfileStacks.Clear();
+			VMProfileSamples = 0;
+			VMProfileCountdown = VMProfileInterval;
+			if (!VMProfiling)
+			{
+				VMProfileSavedExec = VMExec;
+				VMSelectEngine(VMEngine_Profiled);
+				VMProfiling = true;
+			}
+			return;
+		}
+		else if (stricmp(argv[1], "stop") == 0)
+		{
+			if (VMProfiling)
+			{
+				VMExec = VMProfileSavedExec;
+				VMProfiling = false;
+			}
+			return;
+		}
+		else if (stricmp(argv[1], "show") == 0)
+		{
+			VMProfileShow(argv.argc() >= 3 ? (unsigned)strtoul(argv[2], nullptr, 0) : 20);
+			return;
+		}
+		else if (stricmp(argv[1], "dump") == 0 && argv.argc() >= 3)
+		{
+			if (VMProfileDump(argv[2]))
+			{
+				Printf("VM profile written to %s\n", argv[2]);
+			}
+			return;
+		}
+	}
+	Printf("Usage: vmprofile start [<interval>] : Start sampling every <interval> instructions\n");
+	Printf("       vmprofile stop\n");
+	Printf("       vmprofile show [<limit>] : List the busiest functions and lines\n");
+	Printf("       vmprofile dump <filename> : Write folded stacks for flame graph tools\n");
+}
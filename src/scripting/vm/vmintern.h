@@ -423,10 +423,13 @@ enum EVMEngine
 {
 	VMEngine_Default,
 	VMEngine_Unchecked,
-	VMEngine_Checked
+	VMEngine_Checked,
+	VMEngine_Profiled
 };
 
 void VMSelectEngine(EVMEngine engine);
+extern int VMProfileCountdown;
+void VMProfileSample(VMFrame *f, const VMOP *pc);
 extern int (*VMExec)(VMFrameStack *stack, const VMOP *pc, VMReturn *ret, int numret);
 void VMFillParams(VMValue *params, VMFrame *callee, int numparam);
 
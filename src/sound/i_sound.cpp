@@ -61,6 +61,7 @@
 #include "gi.h"
 
 #include "doomdef.h"
+#include "d_net.h"
 
 EXTERN_CVAR (Float, snd_sfxvolume)
 CVAR (Int, snd_samplerate, 0, CVAR_ARCHIVE|CVAR_GLOBALCONFIG)
@@ -241,7 +242,7 @@ public:
 void I_InitSound ()
 {
 	/* Get command line options: */
-	nosound = !!Args->CheckParm ("-nosound");
+	nosound = !!Args->CheckParm ("-nosound") || net_dedicated;
 	nosfx = !!Args->CheckParm ("-nosfx");
 
 	GSnd = NULL;
@@ -56,6 +56,7 @@
 #include "r_utility.h"
 #include "r_renderer.h"
 #include <atomic>
+#include <mutex>
 
 FDynamicColormap NormalLight;
 FDynamicColormap FullNormalLight; //[SP] Emulate GZDoom brightness
@@ -71,16 +72,22 @@ TArray<FSWColormap> SpecialSWColormaps;
 //
 //==========================================================================
 
-static FDynamicColormap *CreateSpecialLights (PalEntry color, PalEntry fade, int desaturate)
+// Maps with many sector colors create thousands of these, so they are also
+// kept in a hash table that the scene threads can search without locking.
+enum { SPECIAL_LIGHTS_HASH = 1024 };
+static std::atomic<FDynamicColormap *> SpecialLightsHash[SPECIAL_LIGHTS_HASH];
+
+static unsigned SpecialLightsKey (PalEntry color, PalEntry fade, int desaturate)
 {
-	// GetSpecialLights is called by the scene worker threads.
-	// If we didn't find the colormap, search again, but this time one thread at a time
-	static std::mutex buildmapmutex;
-	std::unique_lock<std::mutex> lock(buildmapmutex);
+	uint32_t key = (uint32_t)color * 0x9E3779B1u;
+	key = (key ^ (uint32_t)fade) * 0x85EBCA77u;
+	key = (key ^ (uint32_t)desaturate) * 0xC2B2AE3Du;
+	return (key >> 16) % SPECIAL_LIGHTS_HASH;
+}
 
-	// If this colormap has already been created, just return it
-	// This may happen if another thread beat us to it
-	for (FDynamicColormap *colormap = &NormalLight; colormap != NULL; colormap = colormap->Next)
+static FDynamicColormap *FindSpecialLights (PalEntry color, PalEntry fade, int desaturate, unsigned key)
+{
+	for (FDynamicColormap *colormap = SpecialLightsHash[key].load(std::memory_order_acquire); colormap != NULL; colormap = colormap->HashNext)
 	{
 		if (color == colormap->Color &&
 			fade == colormap->Fade &&
@@ -89,10 +96,28 @@ static FDynamicColormap *CreateSpecialLights (PalEntry color, PalEntry fade, int
 			return colormap;
 		}
 	}
+	return NULL;
+}
+
+static FDynamicColormap *CreateSpecialLights (PalEntry color, PalEntry fade, int desaturate, unsigned key)
+{
+	// GetSpecialLights is called by the scene worker threads.
+	// If we didn't find the colormap, search again, but this time one thread at a time
+	static std::mutex buildmapmutex;
+	std::unique_lock<std::mutex> lock(buildmapmutex);
+
+	// If this colormap has already been created, just return it
+	// This may happen if another thread beat us to it
+	FDynamicColormap *colormap = FindSpecialLights(color, fade, desaturate, key);
+	if (colormap != NULL)
+	{
+		return colormap;
+	}
 
 	// Not found. Create it.
-	FDynamicColormap *colormap = new FDynamicColormap;
+	colormap = new FDynamicColormap;
 	colormap->Next = NormalLight.Next;
+	colormap->HashNext = SpecialLightsHash[key].load(std::memory_order_relaxed);
 	colormap->Color = color;
 	colormap->Fade = fade;
 	colormap->Desaturate = desaturate;
@@ -102,24 +127,30 @@ static FDynamicColormap *CreateSpecialLights (PalEntry color, PalEntry fade, int
 	// Make sure colormap is fully built before making it publicly visible
 	std::atomic_thread_fence(std::memory_order_release);
 	NormalLight.Next = colormap;
+	SpecialLightsHash[key].store(colormap, std::memory_order_release);
 
 	return colormap;
 }
 
 FDynamicColormap *GetSpecialLights (PalEntry color, PalEntry fade, int desaturate)
 {
+	// testcolor and testfade can make NormalLight match any color.
+	if (color == NormalLight.Color &&
+		fade == NormalLight.Fade &&
+		desaturate == NormalLight.Desaturate)
+	{
+		return &NormalLight;
+	}
+
 	// If this colormap has already been created, just return it
-	for (FDynamicColormap *colormap = &NormalLight; colormap != NULL; colormap = colormap->Next)
+	unsigned key = SpecialLightsKey(color, fade, desaturate);
+	FDynamicColormap *colormap = FindSpecialLights(color, fade, desaturate, key);
+	if (colormap != NULL)
 	{
-		if (color == colormap->Color &&
-			fade == colormap->Fade &&
-			desaturate == colormap->Desaturate)
-		{
-			return colormap;
-		}
+		return colormap;
 	}
 
-	return CreateSpecialLights(color, fade, desaturate);
+	return CreateSpecialLights(color, fade, desaturate, key);
 }
 
 //==========================================================================
@@ -139,6 +170,10 @@ static void FreeSpecialLights()
 		delete colormap;
 	}
 	NormalLight.Next = NULL;
+	for (auto &bucket : SpecialLightsHash)
+	{
+		bucket.store(NULL, std::memory_order_relaxed);
+	}
 }
 
 //==========================================================================
@@ -21,6 +21,7 @@ struct FDynamicColormap : FSWColormap
 	static void RebuildAllLights();
 
 	FDynamicColormap *Next;
+	FDynamicColormap *HashNext;
 };
 
 extern FSWColormap realcolormaps;					// [RH] make the colormaps externally visible
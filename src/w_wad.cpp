@@ -59,6 +59,10 @@
 #include "doomstat.h"
 #include "vm.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 // MACROS ------------------------------------------------------------------
 
 #define NULL_INDEX		(0xffffffff)
@@ -1246,6 +1250,119 @@ int FWadCollection::GetLumpFile (int lump) const
 	return LumpInfo[lump].wadnum;
 }
 
+//==========================================================================
+//
+// PrefetchLumps
+//
+// Decompresses the given lumps on all cores at once. Each lump keeps the
+// data until it gets cached for the first time, so level precaching does
+// not have to inflate them one by one. Only compressed lumps in archives
+// are handled, everything else can be read directly anyway.
+//
+//==========================================================================
+
+void FWadCollection::PrefetchLumps (const TArray<int> &lumps)
+{
+	struct PrefetchJob
+	{
+		FResourceLump *Lump;
+		FCompressedBuffer Raw;
+		bool Ok;
+	};
+	TArray<PrefetchJob> jobs;
+
+	// Reading the compressed data has to be done here, the archive's
+	// FileReader can only be used by one thread.
+	for (int lumpnum : lumps)
+	{
+		if ((unsigned)lumpnum >= NumLumps)
+			continue;
+
+		FResourceLump *lump = LumpInfo[lumpnum].lump;
+		if (lump->Cache != NULL || lump->Prefetched != NULL || lump->LumpSize <= 0 || !lump->IsCompressed())
+			continue;
+
+		lump->Prefetched = new char[lump->LumpSize];
+		jobs.Push({ lump, lump->GetRawData(), false });
+	}
+	if (jobs.Size() == 0)
+		return;
+
+	std::atomic<unsigned> next(0);
+	auto work = [&]()
+	{
+		unsigned i;
+		while ((i = next++) < jobs.Size())
+		{
+			jobs[i].Ok = jobs[i].Raw.Decompress(jobs[i].Lump->Prefetched, true);
+		}
+	};
+
+	unsigned numthreads = MIN<unsigned>(MAX<unsigned>(std::thread::hardware_concurrency(), 1), jobs.Size());
+	std::vector<std::thread> threads;
+	for (unsigned i = 1; i < numthreads; i++)
+	{
+		threads.push_back(std::thread(work));
+	}
+	work();
+	for (auto &thread : threads)
+	{
+		thread.join();
+	}
+
+	for (auto &job : jobs)
+	{
+		job.Raw.Clean();
+		if (!job.Ok)
+		{ // The workers can't print, so the error gets reported once when the lump is cached.
+			delete[] job.Lump->Prefetched;
+			job.Lump->Prefetched = NULL;
+		}
+	}
+}
+
+//==========================================================================
+//
+// DropPrefetched
+//
+// Frees whatever PrefetchLumps decompressed for these lumps and nobody
+// picked up afterwards.
+//
+//==========================================================================
+
+void FWadCollection::DropPrefetched (const TArray<int> &lumps)
+{
+	for (int lumpnum : lumps)
+	{
+		if ((unsigned)lumpnum >= NumLumps)
+			continue;
+
+		FResourceLump *lump = LumpInfo[lumpnum].lump;
+		if (lump->Prefetched != NULL)
+		{
+			delete[] lump->Prefetched;
+			lump->Prefetched = NULL;
+		}
+	}
+}
+
+//==========================================================================
+//
+// TrimCaches
+//
+// Some archive formats keep decoded data around while many lumps are
+// read at once. Called when that is over.
+//
+//==========================================================================
+
+void FWadCollection::TrimCaches ()
+{
+	for (auto file : Files)
+	{
+		file->TrimCaches();
+	}
+}
+
 //==========================================================================
 //
 // W_ReadLump
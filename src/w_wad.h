@@ -175,6 +175,10 @@ public:
 	FMemLump ReadLump (int lump);
 	FMemLump ReadLump (const char *name) { return ReadLump (GetNumForName (name)); }
 
+	void PrefetchLumps (const TArray<int> &lumps);	// Decompresses archive lumps in parallel
+	void DropPrefetched (const TArray<int> &lumps);	// Frees prefetched data that was never cached
+	void TrimCaches ();		// Frees the archives' loading caches
+
 	FWadLump OpenLumpNum (int lump);
 	FWadLump OpenLumpName (const char *name) { return OpenLumpNum (GetNumForName (name)); }
 	FWadLump *ReopenLumpNum (int lump);	// Opens a new, independent FILE